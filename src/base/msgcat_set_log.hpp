@@ -57,5 +57,6 @@
 #define MSGCAT_LOG_UPTODATE_ERROR                       28
 #define MSGCAT_LOG_LOGINFO_COMMENT_UNUSED_ARCHIVE_NAME	29
 #define MSGCAT_LOG_MAX_ARCHIVES_HAS_BEEN_EXCEEDED	30
+#define MSGCAT_LOG_COPYDB_VOLUME_COPIED			31
 
 #endif // _MSGCAT_SET_LOG_HPP_
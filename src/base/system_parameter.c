@@ -737,6 +737,12 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_ORACLE_STYLE_DIVIDE "oracle_style_divide"
 
+#define PRM_NAME_LIST_FILE_PAGE_COMPRESSION "list_file_page_compression"
+
+#define PRM_NAME_BACKUP_VERIFY_CHANGED_PAGES "backup_verify_changed_pages"
+
+#define PRM_NAME_COMPACTDB_PAGE_RATE_LIMIT "compactdb_page_rate_limit"
+
 /*
  * Note about ERROR_LIST and INTEGER_LIST type
  * ERROR_LIST type is an array of bool type with the size of -(ER_LAST_ERROR)
@@ -2413,6 +2419,20 @@ static int prm_vacuum_ovfp_check_threshold_upper = INT_MAX;
 static int prm_vacuum_ovfp_check_threshold_lower = 2;
 static unsigned int prm_vacuum_ovfp_check_threshold_flag = 0;
 
+bool PRM_LIST_FILE_PAGE_COMPRESSION = false;
+static bool prm_list_file_page_compression_default = false;
+static unsigned int prm_list_file_page_compression_flag = 0;
+
+bool PRM_BACKUP_VERIFY_CHANGED_PAGES = false;
+static bool prm_backup_verify_changed_pages_default = false;
+static unsigned int prm_backup_verify_changed_pages_flag = 0;
+
+int PRM_COMPACTDB_PAGE_RATE_LIMIT = 0;
+static int prm_compactdb_page_rate_limit_default = 0;	/* pages per second, 0 for no limit */
+static int prm_compactdb_page_rate_limit_upper = INT_MAX;
+static int prm_compactdb_page_rate_limit_lower = 0;
+static unsigned int prm_compactdb_page_rate_limit_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6347,6 +6367,40 @@ SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LIST_FILE_PAGE_COMPRESSION,
+   PRM_NAME_LIST_FILE_PAGE_COMPRESSION,
+   (PRM_FOR_CLIENT),
+   PRM_BOOLEAN,
+   &prm_list_file_page_compression_flag,
+   (void *) &prm_list_file_page_compression_default,
+   (void *) &PRM_LIST_FILE_PAGE_COMPRESSION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BACKUP_VERIFY_CHANGED_PAGES,
+   PRM_NAME_BACKUP_VERIFY_CHANGED_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_backup_verify_changed_pages_flag,
+   (void *) &prm_backup_verify_changed_pages_default,
+   (void *) &PRM_BACKUP_VERIFY_CHANGED_PAGES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_COMPACTDB_PAGE_RATE_LIMIT,
+   PRM_NAME_COMPACTDB_PAGE_RATE_LIMIT,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_compactdb_page_rate_limit_flag,
+   (void *) &prm_compactdb_page_rate_limit_default,
+   (void *) &PRM_COMPACTDB_PAGE_RATE_LIMIT,
+   (void *) &prm_compactdb_page_rate_limit_upper,
+   (void *) &prm_compactdb_page_rate_limit_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 static int num_session_parameters = 0;
@@ -475,8 +475,11 @@ enum param_id
   PRM_ID_DEDUPLICATE_KEY_LEVEL,	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   PRM_ID_PRINT_INDEX_DETAIL,	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   PRM_ID_HA_SQL_LOG_MAX_COUNT,
+  PRM_ID_LIST_FILE_PAGE_COMPRESSION,
+  PRM_ID_BACKUP_VERIFY_CHANGED_PAGES,
+  PRM_ID_COMPACTDB_PAGE_RATE_LIMIT,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_HA_SQL_LOG_MAX_COUNT
+  PRM_LAST_ID = PRM_ID_COMPACTDB_PAGE_RATE_LIMIT
 };
 typedef enum param_id PARAM_ID;
 
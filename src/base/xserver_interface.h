@@ -275,6 +275,10 @@ extern int xsession_create_prepared_statement (THREAD_ENTRY * thread_p, char *na
 extern int xsession_get_prepared_statement (THREAD_ENTRY * thread_p, const char *name, char **info, int *info_len,
 					    XASL_ID * xasl_id, xasl_node_header * xasl_header_p);
 extern int xsession_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name);
+extern int xsession_share_prepared_statement (THREAD_ENTRY * thread_p, const char *key, const char *alias_print,
+					      const SHA1Hash * sha1, const char *info, int info_len);
+extern int xsession_attach_shared_prepared_statement (THREAD_ENTRY * thread_p, const char *name, const char *key,
+						      bool * found);
 
 extern int xlogin_user (THREAD_ENTRY * thread_p, const char *username);
 
@@ -196,6 +196,10 @@
 
 #define JOB_COUNT_MAX		130000000
 
+/* wait between idle cas searches when all cas are busy; doubles up to the max */
+#define IDLE_CAS_WAIT_MSEC_MIN	1
+#define IDLE_CAS_WAIT_MSEC_MAX	30
+
 /* num of collecting counts per monitoring interval */
 #define NUM_COLLECT_COUNT_PER_INTVL     4
 #define HANG_COUNT_THRESHOLD_RATIO      0.5
@@ -1166,6 +1170,7 @@ dispatch_thr_f (void *arg)
 #endif /* !WINDOWS */
 
   int as_index, i;
+  int idle_cas_wait_msec;
 
   job_queue = shm_appl->job_queue;
 
@@ -1212,6 +1217,7 @@ dispatch_thr_f (void *arg)
 #if !defined (WINDOWS)
     retry:
 #endif
+      idle_cas_wait_msec = IDLE_CAS_WAIT_MSEC_MIN;
       while (1)
 	{
 	  as_index = find_idle_cas ();
@@ -1223,7 +1229,13 @@ dispatch_thr_f (void *arg)
 		}
 	      else
 		{
-		  SLEEP_MILISEC (0, 30);
+		  /* short transactions free a cas within a few msec; poll quickly first, then back off */
+		  SLEEP_MILISEC (0, idle_cas_wait_msec);
+		  idle_cas_wait_msec *= 2;
+		  if (idle_cas_wait_msec > IDLE_CAS_WAIT_MSEC_MAX)
+		    {
+		      idle_cas_wait_msec = IDLE_CAS_WAIT_MSEC_MAX;
+		    }
 		}
 	    }
 	  else
@@ -2714,12 +2726,14 @@ find_idle_cas (void)
   int idle_cas_id = -1;
   time_t max_wait_time;
   int wait_cas_id;
+  bool is_all_cas_running;
   time_t cur_time = time (NULL);
 
   pthread_mutex_lock (&broker_shm_mutex);
 
   wait_cas_id = -1;
   max_wait_time = 0;
+  is_all_cas_running = (shm_br->br_info[br_index].appl_server_num == shm_br->br_info[br_index].appl_server_max_num);
 
   for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
     {
@@ -2737,8 +2751,8 @@ find_idle_cas (void)
 	  wait_cas_id = -1;
 	  break;
 	}
-      if (shm_br->br_info[br_index].appl_server_num == shm_br->br_info[br_index].appl_server_max_num
-	  && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY && shm_appl->as_info[i].cur_keep_con == KEEP_CON_AUTO
+      if (is_all_cas_running && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY
+	  && shm_appl->as_info[i].cur_keep_con == KEEP_CON_AUTO
 	  && shm_appl->as_info[i].con_status == CON_STATUS_OUT_TRAN && shm_appl->as_info[i].num_holdable_results < 1
 	  && shm_appl->as_info[i].cas_change_mode == CAS_CHANGE_MODE_AUTO)
 	{
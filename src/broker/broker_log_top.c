@@ -639,6 +639,7 @@ log_top (FILE * fp, char *filename, long start_offset, long end_offset)
 	  query_info_buf[qi_idx].sql = (char *) REALLOC (query_info_buf[qi_idx].sql, t_string_len (sql_buf) + 1);
 
 	  strcpy (query_info_buf[qi_idx].sql, ut_trim (t_string_str (sql_buf)));
+	  FREE_MEM (query_info_buf[qi_idx].organized_sql);
 	  query_info_buf[qi_idx].organized_sql = organize_query_string (query_info_buf[qi_idx].sql);
 
 	  msg_p = get_msg_start_ptr (linebuf);
@@ -2595,6 +2595,37 @@ metadata_monitor (double elapsed_time)
 	}
       print_newline ();
 
+      if (full_info_flag)
+	{
+	  INT64 latency_hist[SHARD_CAS_LATENCY_HIST_SIZE];
+
+	  str_out ("SHARD_CAS_LATENCY");
+	  print_newline ();
+	  str_out ("\t%8s %10s %10s %10s %10s %10s", "SHARD_ID", "<1ms", "<10ms", "<100ms", "<1s", ">=1s");
+	  print_newline ();
+	  str_out ("\t%s", "------------------------------------------------------------------");
+	  print_newline ();
+
+	  for (shard_index = 0; shard_index < num_shard; shard_index++)
+	    {
+	      memset (latency_hist, 0, sizeof (latency_hist));
+	      for (proxy_index = 0; proxy_index < num_proxy; proxy_index++)
+		{
+		  proxy_info_p = shard_shm_find_proxy_info (shm_proxy_p, proxy_index);
+		  shard_info_p = shard_shm_find_shard_info (proxy_info_p, shard_index);
+		  for (k = 0; k < SHARD_CAS_LATENCY_HIST_SIZE; k++)
+		    {
+		      latency_hist[k] += shard_info_p->cas_latency_hist[k];
+		    }
+		}
+
+	      str_out ("\t%8d %10" PRId64 " %10" PRId64 " %10" PRId64 " %10" PRId64 " %10" PRId64, shard_index,
+		       latency_hist[0], latency_hist[1], latency_hist[2], latency_hist[3], latency_hist[4]);
+	      print_newline ();
+	    }
+	  print_newline ();
+	}
+
       /* PRINT KEY STATISTICS */
       if (full_info_flag)
 	{
@@ -407,6 +407,9 @@ struct t_client_info
   int lock_timeout;
 };
 
+/* CAS hold time buckets: < 1ms, < 10ms, < 100ms, < 1s, >= 1s */
+#define SHARD_CAS_LATENCY_HIST_SIZE     5
+
 typedef struct t_shard_info T_SHARD_INFO;
 struct t_shard_info
 {
@@ -419,6 +422,9 @@ struct t_shard_info
   /* shard queue stat */
   INT64 waiter_count;
 
+  /* how long a CAS of this shard was held by a client context */
+  INT64 cas_latency_hist[SHARD_CAS_LATENCY_HIST_SIZE];
+
   int as_info_index_base;
 };
 
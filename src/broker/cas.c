@@ -2354,6 +2354,9 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 
 exit_on_end:
 
+  /* the response is sent; write out the sql log lines of this request */
+  cas_log_flush ();
+
   if (cas_shard_flag == ON && as_info->con_status != CON_STATUS_IN_TRAN && as_info->uts_status == UTS_STATUS_BUSY)
     {
       as_info->uts_status = UTS_STATUS_IDLE;
@@ -204,6 +204,7 @@ static int cur_tuple (T_QUERY_RESULT * q_result, int max_col_size, char sensitiv
 		      T_NET_BUF * net_buf);
 static int dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_col_size,
 			     char column_type_flag);
+static int fixed_value_to_net_buf (DB_QUERY_RESULT * result, int col_index, T_NET_BUF * net_buf);
 static void dbobj_to_casobj (DB_OBJECT * obj, T_OBJECT * cas_obj);
 static void casobj_to_dbobj (T_OBJECT * cas_obj, DB_OBJECT ** obj);
 static void dblob_to_caslob (DB_VALUE * lob, T_LOB_HANDLE * cas_lob);
@@ -4917,6 +4918,7 @@ cur_tuple (T_QUERY_RESULT * q_result, int max_col_size, char sensitive_flag, DB_
   T_COL_UPDATE_INFO *col_update_info = q_result->col_update_info;
   char *null_type_column = q_result->null_type_column;
   int err_code;
+  int size;
 
   ncols = db_query_column_count (result);
   for (i = 0; i < ncols; i++)
@@ -4934,6 +4936,20 @@ cur_tuple (T_QUERY_RESULT * q_result, int max_col_size, char sensitive_flag, DB_
 	}
       else
 	{
+	  if (null_type_column == NULL || null_type_column[i] == 0)
+	    {
+	      size = fixed_value_to_net_buf (result, i, net_buf);
+	      if (size < 0)
+		{
+		  return size;
+		}
+	      else if (size > 0)
+		{
+		  data_size += size;
+		  continue;
+		}
+	    }
+
 	  error = db_query_get_tuple_value (result, i, &val);
 	}
 
@@ -4952,6 +4968,63 @@ cur_tuple (T_QUERY_RESULT * q_result, int max_col_size, char sensitive_flag, DB_
   return data_size;
 }
 
+/*
+ * fixed_value_to_net_buf - copy a fixed-width column of the current tuple straight from the list file
+ *   return: bytes added to net_buf, 0 if the column must go through dbval_to_net_buf, or error
+ *   result(in): query result positioned on the tuple
+ *   col_index(in): column index
+ *   net_buf(in/out): output buffer
+ *
+ * Note: the list file keeps these types in network byte order, which is
+ *       exactly what add_res_data_* would produce, so no DB_VALUE is built.
+ */
+static int
+fixed_value_to_net_buf (DB_QUERY_RESULT * result, int col_index, T_NET_BUF * net_buf)
+{
+  DB_TYPE type;
+  const char *bytes;
+  int size;
+  int error;
+
+  error = db_query_peek_tuple_value_bytes (result, col_index, &type, &bytes);
+  if (error < 0)
+    {
+      return ERROR_INFO_SET (error, DBMS_ERROR_INDICATOR);
+    }
+
+  switch (type)
+    {
+    case DB_TYPE_SMALLINT:
+      size = NET_SIZE_SHORT;
+      break;
+    case DB_TYPE_INTEGER:
+      size = NET_SIZE_INT;
+      break;
+    case DB_TYPE_BIGINT:
+      size = NET_SIZE_BIGINT;
+      break;
+    case DB_TYPE_FLOAT:
+      size = NET_SIZE_FLOAT;
+      break;
+    case DB_TYPE_DOUBLE:
+      size = NET_SIZE_DOUBLE;
+      break;
+    default:
+      return 0;
+    }
+
+  if (bytes == NULL)
+    {
+      net_buf_cp_int (net_buf, -1, NULL);
+      return NET_SIZE_INT;
+    }
+
+  net_buf_cp_int (net_buf, size, NULL);
+  net_buf_cp_str (net_buf, bytes, size);
+
+  return NET_SIZE_INT + size;
+}
+
 static int
 dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_col_size, char column_type_flag)
 {
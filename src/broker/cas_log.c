@@ -64,6 +64,8 @@ typedef int mode_t;
 
 #define CAS_LOG_BUFFER_SIZE (8192)
 #define SQL_LOG_BUFFER_SIZE 163840
+#define SQL_LOG_FLUSH_INTERVAL_MSEC 1000
+#define CAS_LOG_TIME_STRING_SEC_LEN 17	/* "YY-MM-DD hh:mm:ss" */
 #define ACCESS_LOG_IS_DENIED_TYPE(T)  ((T)==ACL_REJECTED)
 
 static const char *get_access_log_type_string (ACCESS_LOG_TYPE type);
@@ -81,6 +83,8 @@ static void cas_log_rename (int run_time, time_t cur_time, char *br_name, int as
 static void cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_num, bool do_flush,
 				    const char *fmt, va_list ap);
 static void cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap);
+static int cas_log_time_string (char *buf, struct timeval *log_time, struct timeval *now);
+static bool cas_log_is_flush_due (FILE * fp, struct timeval *now);
 
 static FILE *access_log_open (char *log_file_name);
 static bool cas_log_begin_hang_check_time (void);
@@ -96,6 +100,7 @@ static FILE *log_fp = NULL, *slow_log_fp = NULL;
 static char log_filepath[BROKER_PATH_MAX], slow_log_filepath[BROKER_PATH_MAX];
 static INT64 saved_log_fpos = 0;
 static CAS_LOG_FD_STATUS cas_log_fd_status = CAS_LOG_FD_NONE;
+static struct timeval log_last_flush_time = { 0, 0 };
 
 static size_t cas_fwrite (const void *ptr, size_t size, size_t nmemb, FILE * stream);
 static INT64 cas_ftell (FILE * stream);
@@ -415,9 +420,11 @@ cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_nu
   char *buf, *p;
   int len, n;
 
+  struct timeval now;
+
   p = buf = cas_log_buffer;
   len = CAS_LOG_BUFFER_SIZE;
-  n = ut_time_string (p, log_time);
+  n = cas_log_time_string (p, log_time, &now);
   len -= n;
   p += n;
 
@@ -441,12 +448,94 @@ cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_nu
 
   cas_fwrite (buf, (p - buf), 1, fp);
 
-  if (do_flush == true)
+  if (do_flush == true && cas_log_is_flush_due (fp, &now))
     {
       cas_fflush (fp);
     }
 }
 
+/*
+ * cas_log_time_string () - format the "YY-MM-DD hh:mm:ss.mmm" prefix of a log line
+ *   return: length of the string written into buf
+ *   buf(out): at least 22 bytes
+ *   log_time(in): time to print, or NULL for the current time
+ *   now(out): current time
+ *
+ *   Note: localtime_r () is only called when the second changes; lines logged within the same second reuse the
+ *         previously formatted date and time.
+ */
+static int
+cas_log_time_string (char *buf, struct timeval *log_time, struct timeval *now)
+{
+  static char cached_sec_str[CAS_LOG_TIME_STRING_SEC_LEN + 1] = "";
+  static time_t cached_sec = 0;
+  int millisec;
+
+  gettimeofday (now, NULL);
+  if (log_time == NULL)
+    {
+      log_time = now;
+    }
+
+  if (cached_sec_str[0] == '\0' || log_time->tv_sec != cached_sec)
+    {
+      (void) ut_time_string (buf, log_time);
+      memcpy (cached_sec_str, buf, CAS_LOG_TIME_STRING_SEC_LEN);
+      cached_sec_str[CAS_LOG_TIME_STRING_SEC_LEN] = '\0';
+      cached_sec = log_time->tv_sec;
+      return CAS_LOG_TIME_STRING_SEC_LEN + 4;
+    }
+
+  memcpy (buf, cached_sec_str, CAS_LOG_TIME_STRING_SEC_LEN);
+  millisec = log_time->tv_usec / 1000;
+  buf[17] = '.';
+  buf[18] = (millisec / 100) + '0';
+  buf[19] = ((millisec / 10) % 10) + '0';
+  buf[20] = (millisec % 10) + '0';
+  buf[21] = '\0';
+
+  return CAS_LOG_TIME_STRING_SEC_LEN + 4;
+}
+
+/*
+ * cas_log_is_flush_due () - check whether lines buffered in the sql log should be written out now
+ *   return: true if fp must be flushed
+ *   fp(in): log file
+ *   now(in): current time, or NULL
+ *
+ *   Note: with SQL_LOG=ALL every line used to be flushed, which costs a write () per line. Lines are now written
+ *         out in batches: at the end of each request (cas_log_flush) and, for long requests, at least every
+ *         SQL_LOG_FLUSH_INTERVAL_MSEC.
+ */
+static bool
+cas_log_is_flush_due (FILE * fp, struct timeval *now)
+{
+  struct timeval tv;
+  int elapsed_sec, elapsed_msec;
+  INT64 elapsed;
+
+  if (fp != log_fp)
+    {
+      return true;
+    }
+
+  if (now == NULL)
+    {
+      gettimeofday (&tv, NULL);
+      now = &tv;
+    }
+
+  ut_timeval_diff (&log_last_flush_time, now, &elapsed_sec, &elapsed_msec);
+  elapsed = (INT64) elapsed_sec * 1000 + elapsed_msec;
+  if (elapsed >= 0 && elapsed < SQL_LOG_FLUSH_INTERVAL_MSEC)
+    {
+      return false;
+    }
+
+  log_last_flush_time = *now;
+  return true;
+}
+
 void
 cas_log_write_nonl (unsigned int seq_num, bool unit_start, const char *fmt, ...)
 {
@@ -610,6 +699,23 @@ cas_log_get_fd_status (void)
   return cas_log_fd_status;
 }
 
+/*
+ * cas_log_flush () - write out the lines buffered in the sql log
+ *   return: none
+ *
+ *   Note: called at the end of each request, so that lines held back by cas_log_is_flush_due () do not wait for
+ *         the next request or the end of the transaction.
+ */
+void
+cas_log_flush (void)
+{
+  if (log_fp != NULL)
+    {
+      cas_fflush (log_fp);
+      gettimeofday (&log_last_flush_time, NULL);
+    }
+}
+
 static void
 cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap)
 {
@@ -629,7 +735,7 @@ cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap)
 
   cas_fwrite (buf, (p - buf), 1, fp);
 
-  if (do_flush == true)
+  if (do_flush == true && cas_log_is_flush_due (fp, NULL))
     {
       cas_fflush (fp);
     }
@@ -33,6 +33,7 @@
 
 #include "cas_common.h"
 #include "cas_query_info.h"
+#include "memory_hash.h"
 #include "broker_log_sql_list.h"
 #include "broker_log_top.h"
 
@@ -41,11 +42,21 @@
 #define LOG_TOP_TAG_FILE	"tags"
 #define LOG_TOP_NE_FILE		"log_top.ne"
 
+#define QUERY_INFO_HASH_SIZE	4096
+#define QUERY_INFO_ARR_GROW	1024
+
+/* the hash keeps index + 1 so that a found entry is never NULL */
+#define QUERY_INFO_IDX_TO_DATA(i)	((void *) (UINTPTR) ((i) + 1))
+#define QUERY_INFO_DATA_TO_IDX(d)	((int) ((UINTPTR) (d)) - 1)
+
 static int sort_func (const void *arg1, const void *arg2);
 static char *time2str (int t, char *buf);
+static int query_info_find (const char *organized_sql);
 
 static T_QUERY_INFO *query_info_arr = NULL;
 static int num_query_info = 0;
+static int max_query_info = 0;
+static MHT_TABLE *query_info_hash = NULL;
 
 #ifdef TEST
 static T_QUERY_INFO *query_info_arr_ne = NULL;
@@ -193,7 +204,6 @@ int
 query_info_add (T_QUERY_INFO * qi, int exec_time, int execute_res, char *filename, int lineno, char *end_date)
 {
   int qi_idx = -1;
-  int i;
   int retval;
 
   if (check_log_time (qi->start_date, end_date) < 0)
@@ -208,28 +218,50 @@ query_info_add (T_QUERY_INFO * qi, int exec_time, int execute_res, char *filenam
     goto query_info_add_end;
 #endif
 
-  for (i = 0; i < num_query_info; i++)
+  qi_idx = query_info_find (qi->organized_sql);
+
+  if (qi_idx == -1)
     {
-      if (strcmp (query_info_arr[i].organized_sql, qi->organized_sql) == 0)
+      if (query_info_hash == NULL)
 	{
-	  qi_idx = i;
-	  break;
+	  query_info_hash =
+	    mht_create ("broker_log_top queries", QUERY_INFO_HASH_SIZE, mht_5strhash, mht_compare_strings_are_equal);
+	  if (query_info_hash == NULL)
+	    {
+	      fprintf (stderr, "malloc error\n");
+	      retval = -1;
+	      goto query_info_add_end;
+	    }
 	}
-    }
 
-  if (qi_idx == -1)
-    {
-      query_info_arr = (T_QUERY_INFO *) REALLOC (query_info_arr, sizeof (T_QUERY_INFO) * (num_query_info + 1));
-      if (query_info_arr == NULL)
+      if (num_query_info == max_query_info)
 	{
-	  fprintf (stderr, "%s\n", strerror (errno));
-	  retval = -1;
-	  goto query_info_add_end;
+	  T_QUERY_INFO *new_arr;
+
+	  new_arr = (T_QUERY_INFO *) REALLOC (query_info_arr,
+					      sizeof (T_QUERY_INFO) * (max_query_info + QUERY_INFO_ARR_GROW));
+	  if (new_arr == NULL)
+	    {
+	      fprintf (stderr, "%s\n", strerror (errno));
+	      retval = -1;
+	      goto query_info_add_end;
+	    }
+	  query_info_arr = new_arr;
+	  max_query_info += QUERY_INFO_ARR_GROW;
 	}
+
       qi_idx = num_query_info;
       query_info_init (&query_info_arr[qi_idx]);
       query_info_arr[qi_idx].sql = strdup (qi->sql);
       query_info_arr[qi_idx].organized_sql = strdup (qi->organized_sql);
+      if (query_info_arr[qi_idx].sql == NULL || query_info_arr[qi_idx].organized_sql == NULL
+	  || mht_put (query_info_hash, query_info_arr[qi_idx].organized_sql, QUERY_INFO_IDX_TO_DATA (qi_idx)) == NULL)
+	{
+	  fprintf (stderr, "malloc error\n");
+	  query_info_clear (&query_info_arr[qi_idx]);
+	  retval = -1;
+	  goto query_info_add_end;
+	}
       num_query_info++;
     }
 
@@ -289,13 +321,10 @@ query_info_add_ne (T_QUERY_INFO * qi, char *end_date)
   MUTEX_LOCK (query_info_mutex);
 #endif
 
-  for (i = 0; i < num_query_info; i++)
+  if (query_info_find (qi->organized_sql) != -1)
     {
-      if (strcmp (query_info_arr[i].organized_sql, qi->organized_sql) == 0)
-	{
-	  retval = 0;
-	  goto query_info_add_ne_end;
-	}
+      retval = 0;
+      goto query_info_add_ne_end;
     }
 
   for (i = 0; i < num_query_info_ne; i++)
@@ -342,6 +371,33 @@ query_info_add_ne_end:
 #endif /* define TEST */
 }
 
+/*
+ * query_info_find () - find the summary entry of a normalized query
+ *   return: index into query_info_arr, or -1 if the query was not seen yet
+ *   organized_sql(in): normalized query string
+ *
+ *   Note: every execute line of every log file is looked up here, so the entries are indexed by a hash on the
+ *         normalized query instead of comparing against all of them.
+ */
+static int
+query_info_find (const char *organized_sql)
+{
+  void *data;
+
+  if (query_info_hash == NULL || organized_sql == NULL)
+    {
+      return -1;
+    }
+
+  data = mht_get (query_info_hash, organized_sql);
+  if (data == NULL)
+    {
+      return -1;
+    }
+
+  return QUERY_INFO_DATA_TO_IDX (data);
+}
+
 static int
 sort_func (const void *arg1, const void *arg2)
 {
@@ -187,6 +187,9 @@ struct t_cas_io
 
   SOCKET fd;
 
+  struct timeval alloc_time;	/* when the current context got this CAS */
+  INT64 avg_hold_usec_x8;	/* moving average of how long a context holds this CAS, in usec scaled by 8 */
+
   /* send queue ? */
 };
 
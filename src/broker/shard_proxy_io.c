@@ -26,6 +26,7 @@
 
 
 #include <assert.h>
+#include <limits.h>
 #include <signal.h>
 #include <string.h>
 #if defined(LINUX)
@@ -171,6 +172,8 @@ static void proxy_set_conn_info (int func_code, int ctx_cid, int ctx_uid, int sh
 static T_CAS_IO *proxy_find_idle_cas_by_asc (int shard_id, int cas_id, int ctx_cid, unsigned int ctx_uid);
 static T_CAS_IO *proxy_find_idle_cas_by_desc (int shard_id, int cas_id, int ctx_cid, unsigned int ctx_uid);
 static T_CAS_IO *proxy_find_idle_cas_by_conn_info (int shard_id, int cas_id, int ctx_cid, unsigned int ctx_uid);
+static bool proxy_cas_is_less_loaded (T_CAS_IO * cas_io_p, T_CAS_IO * best_cas_io_p);
+static void proxy_cas_update_latency (T_SHARD_IO * shard_io_p, T_CAS_IO * cas_io_p);
 static T_CAS_IO *proxy_cas_alloc_by_shard_and_cas_id (int client_id, int shard_id, int cas_id, int ctx_cid,
 						      unsigned int ctx_uid);
 static T_CAS_IO *proxy_cas_alloc_anything (int client_id, int shard_id, int cas_id, int ctx_cid, unsigned int ctx_uid,
@@ -3201,6 +3204,7 @@ proxy_cas_io_initialize (int shard_id, T_CAS_IO ** cas_io_pp, int size)
       cas_io_p->ctx_cid = PROXY_INVALID_CONTEXT;
       cas_io_p->ctx_uid = 0;
       cas_io_p->fd = INVALID_SOCKET;
+      cas_io_p->avg_hold_usec_x8 = 0;
     }
 
   *cas_io_pp = buffer;
@@ -3418,6 +3422,7 @@ proxy_cas_io_new (int shard_id, int cas_id, SOCKET fd)
   cas_io_p->is_in_tran = false;
   cas_io_p->ctx_cid = PROXY_INVALID_CONTEXT;
   cas_io_p->ctx_uid = 0;
+  cas_io_p->avg_hold_usec_x8 = 0;
 
   shard_io_p->cur_num_cas++;
 
@@ -3683,6 +3688,10 @@ proxy_cas_alloc_by_ctx (int client_id, int shard_id, int cas_id, int ctx_cid, un
 		 cas_io_p->shard_id, cas_io_p->cas_id);
     }
 
+  if (cas_io_p->is_in_tran == false)
+    {
+      gettimeofday (&cas_io_p->alloc_time, NULL);
+    }
   cas_io_p->is_in_tran = true;
   cas_io_p->ctx_cid = ctx_cid;
   cas_io_p->ctx_uid = ctx_uid;
@@ -3756,6 +3765,8 @@ proxy_cas_release_by_ctx (int shard_id, int cas_id, int ctx_cid, unsigned int ct
       return;
     }
 
+  proxy_cas_update_latency (shard_io_p, cas_io_p);
+
   cas_io_p->is_in_tran = false;
   cas_io_p->ctx_cid = PROXY_INVALID_CONTEXT;
   cas_io_p->ctx_uid = 0;
@@ -4668,11 +4679,67 @@ proxy_cas_alloc_by_shard_and_cas_id (int client_id, int shard_id, int cas_id, in
   return cas_io_p;
 }
 
+/*
+ * proxy_cas_is_less_loaded () - is the CAS a better choice than the best one found so far
+ *   return: true if cas_io_p should be preferred
+ *   cas_io_p(in): idle CAS
+ *   best_cas_io_p(in): best idle CAS found so far, may be NULL
+ *
+ * Note: an idle CAS has nothing in flight, so CAS are ranked by how long
+ *       contexts recently held them; ties keep the lower CAS id.
+ */
+static bool
+proxy_cas_is_less_loaded (T_CAS_IO * cas_io_p, T_CAS_IO * best_cas_io_p)
+{
+  return (best_cas_io_p == NULL || cas_io_p->avg_hold_usec_x8 < best_cas_io_p->avg_hold_usec_x8);
+}
+
+/*
+ * proxy_cas_update_latency () - account the time the current context held the CAS
+ *   return: void
+ *   shard_io_p(in): shard of the CAS
+ *   cas_io_p(in): CAS being released
+ */
+static void
+proxy_cas_update_latency (T_SHARD_IO * shard_io_p, T_CAS_IO * cas_io_p)
+{
+  struct timeval now;
+  INT64 hold_usec;
+  INT64 hold_msec;
+  T_SHARD_INFO *shard_info_p;
+  int bucket;
+
+  gettimeofday (&now, NULL);
+  hold_usec =
+    (INT64) (now.tv_sec - cas_io_p->alloc_time.tv_sec) * 1000000LL + (now.tv_usec - cas_io_p->alloc_time.tv_usec);
+  if (hold_usec < 0)
+    {
+      hold_usec = 0;
+    }
+
+  /* weight the last hold as 1/8 so that a single slow transaction does not pin the CAS. The average is kept in usec
+   * and scaled by 8, so that short holds are not rounded down to zero. */
+  cas_io_p->avg_hold_usec_x8 += hold_usec - (cas_io_p->avg_hold_usec_x8 >> 3);
+
+  hold_msec = hold_usec / 1000;
+
+  shard_info_p = shard_shm_find_shard_info (proxy_info_p, shard_io_p->shard_id);
+  if (shard_info_p != NULL)
+    {
+      for (bucket = 0; bucket < SHARD_CAS_LATENCY_HIST_SIZE - 1 && hold_msec >= 1; bucket++)
+	{
+	  hold_msec /= 10;
+	}
+      shard_info_p->cas_latency_hist[bucket]++;
+    }
+}
+
 static T_CAS_IO *
 proxy_find_idle_cas_by_asc (int shard_id, int cas_id, int ctx_cid, unsigned int ctx_uid)
 {
   int i = 0;
   T_CAS_IO *cas_io_p = NULL;
+  T_CAS_IO *best_cas_io_p = NULL;
   T_SHARD_IO *shard_io_p = NULL;
 
   shard_io_p = &(proxy_Shard_io.ent[shard_id]);
@@ -4686,10 +4753,13 @@ proxy_find_idle_cas_by_asc (int shard_id, int cas_id, int ctx_cid, unsigned int
 	  continue;
 	}
 
-      return cas_io_p;
+      if (proxy_cas_is_less_loaded (cas_io_p, best_cas_io_p))
+	{
+	  best_cas_io_p = cas_io_p;
+	}
     }
 
-  return NULL;
+  return best_cas_io_p;
 }
 
 static T_CAS_IO *
@@ -4721,6 +4791,7 @@ proxy_find_idle_cas_by_conn_info (int shard_id, int cas_id, int ctx_cid, unsigne
 {
   int i = 0;
   T_CAS_IO *cas_io_p = NULL;
+  T_CAS_IO *best_cas_io_p = NULL;
   T_SHARD_IO *shard_io_p = NULL;
   T_PROXY_CONTEXT *ctx_p = NULL;
   T_APPL_SERVER_INFO *as_info_p = NULL;
@@ -4758,10 +4829,13 @@ proxy_find_idle_cas_by_conn_info (int shard_id, int cas_id, int ctx_cid, unsigne
 	    }
 	}
 
-      return cas_io_p;
+      if (proxy_cas_is_less_loaded (cas_io_p, best_cas_io_p))
+	{
+	  best_cas_io_p = cas_io_p;
+	}
     }
 
-  return NULL;
+  return best_cas_io_p;
 }
 
 static T_CAS_IO *
@@ -556,6 +556,12 @@ shard_shm_dump_shard (FILE * fp, T_SHARD_INFO * shard_info_p, T_SHM_APPL_SERVER
   fprintf (fp, BLANK_6 "%-30s = %-30d \n", "MAX_APPL_SERVER", shard_info_p->max_appl_server);
   fprintf (fp, BLANK_6 "%-30s = %-30d \n", "NUM_APPL_SERVER", shard_info_p->num_appl_server);
   fprintf (fp, BLANK_6 "%-30s = %-30llu \n", "WAITER_COUNT", (long long unsigned int) shard_info_p->waiter_count);
+  fprintf (fp, BLANK_6 "%-30s = %llu/%llu/%llu/%llu/%llu \n", "CAS_LATENCY(1ms/10ms/100ms/1s/more)",
+	   (long long unsigned int) shard_info_p->cas_latency_hist[0],
+	   (long long unsigned int) shard_info_p->cas_latency_hist[1],
+	   (long long unsigned int) shard_info_p->cas_latency_hist[2],
+	   (long long unsigned int) shard_info_p->cas_latency_hist[3],
+	   (long long unsigned int) shard_info_p->cas_latency_hist[4]);
 
   for (i = 0; i < shard_info_p->max_appl_server; i++)
     {
@@ -222,6 +222,7 @@ enum net_server_request
   NET_SERVER_SES_CREATE_PREPARED_STATEMENT,
   NET_SERVER_SES_GET_PREPARED_STATEMENT,
   NET_SERVER_SES_DELETE_PREPARED_STATEMENT,
+  NET_SERVER_SES_ATTACH_SHARED_PREPARED_STATEMENT,
   NET_SERVER_SES_SET_SESSION_VARIABLES,
   NET_SERVER_SES_GET_SESSION_VARIABLE,
   NET_SERVER_SES_DROP_SESSION_VARIABLES,
@@ -288,6 +289,8 @@ enum net_server_request
 #define NET_CAP_INTERRUPT_ENABLED       0x00800000
 #define NET_CAP_UPDATE_DISABLED         0x00008000
 #define NET_CAP_REMOTE_DISABLED         0x00000080
+#define NET_CAP_END_QUERIES_ON_EXECUTE  0x00000020	/* ends deferred queries sent with an execute request */
+#define NET_CAP_LIST_PAGE_COMPRESSION   0x00000010	/* list file pages may be sent LZ4 compressed */
 #define NET_CAP_HA_REPL_DELAY           0x00000008
 #define NET_CAP_HA_REPLICA              0x00000004
 #define NET_CAP_HA_IGNORE_REPL_DELAY	0x00000002
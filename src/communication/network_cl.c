@@ -92,6 +92,9 @@ static char net_Server_host[CUB_MAXHOSTNAMELEN + 1] = "";
 /* Contains the name of the current server name. */
 static char net_Server_name[DB_MAX_IDENTIFIER_LENGTH + 1] = "";
 
+/* Contains the capabilities the current server sent in the handshake. */
+static int net_Server_capabilities = 0;
+
 static void return_error_to_server (char *host, unsigned int eid);
 static int client_capabilities (void);
 static int check_server_capabilities (int server_cap, int client_type, int rel_compare,
@@ -166,6 +169,7 @@ set_server_error (int error)
     {
       net_Server_name[0] = '\0';
       net_Server_host[0] = '\0';
+      net_Server_capabilities = 0;
       boot_server_die_or_changed ();
     }
 
@@ -210,6 +214,8 @@ client_capabilities (void)
   int capabilities = 0;
 
   capabilities |= NET_CAP_INTERRUPT_ENABLED;
+  capabilities |= NET_CAP_END_QUERIES_ON_EXECUTE;
+  capabilities |= NET_CAP_LIST_PAGE_COMPRESSION;
   if (db_Disable_modifications > 0)
     {
       capabilities |= NET_CAP_UPDATE_DISABLED;
@@ -455,6 +461,18 @@ net_client_get_server_host (void)
   return net_Server_host;
 }
 
+/*
+ * net_client_server_has_capability () - check a capability of the current server
+ *
+ * return: true if the server sent all the given capabilities in the handshake
+ *   capability(in): NET_CAP_* bits
+ */
+bool
+net_client_server_has_capability (int capability)
+{
+  return (net_Server_capabilities & capability) == capability;
+}
+
 /*
  * net_client_get_server_name () - the name of the current sever
  *
@@ -3540,6 +3558,9 @@ net_client_ping_server_with_handshake (int client_type, bool check_capabilities,
   ptr = or_unpack_int (ptr, &server_bit_platform);
   ptr = or_unpack_string_nocopy (ptr, &server_host);
 
+  /* an older server does not send the capabilities of newer request formats; they are not used with it */
+  net_Server_capabilities = server_capabilities;
+
   /* get the error code which was from the server if it exists */
   error = er_errid ();
   if (error != NO_ERROR)
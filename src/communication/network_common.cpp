@@ -197,6 +197,7 @@ const char *net_server_request_name[NET_SERVER_REQUEST_END] =
   "NET_SERVER_SES_CREATE_PREPARED_STATEMENT",
   "NET_SERVER_SES_GET_PREPARED_STATEMENT",
   "NET_SERVER_SES_DELETE_PREPARED_STATEMENT",
+  "NET_SERVER_SES_ATTACH_SHARED_PREPARED_STATEMENT",
   "NET_SERVER_SES_SET_SESSION_VARIABLES",
   "NET_SERVER_SES_GET_SESSION_VARIABLE",
   "NET_SERVER_SES_DROP_SESSION_VARIABLES",
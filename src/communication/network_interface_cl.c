@@ -76,6 +76,7 @@
 #include "method_error.hpp"
 #include "message_catalog.h"
 #include "utility.h"
+#include "lz4.h"
 
 /*
  * Use db_clear_private_heap instead of db_destroy_private_heap
@@ -4945,9 +4946,11 @@ csession_reset_cur_insert_id (void)
  * alias_print(in): the compiled statement string
  * stmt_info (in) : serialized prepared statement information
  * info_length(in): the size of the serialized buffer
+ * share_key (in) : if not NULL, the key under which the statement is shared with other sessions
  */
 int
-csession_create_prepared_statement (const char *name, const char *alias_print, char *stmt_info, int info_length)
+csession_create_prepared_statement (const char *name, const char *alias_print, char *stmt_info, int info_length,
+				    const char *share_key)
 {
 #if defined (CS_MODE)
   int req_error;
@@ -4955,7 +4958,7 @@ csession_create_prepared_statement (const char *name, const char *alias_print, c
   char *request = NULL;
   char *reply = NULL;
   char *ptr = NULL;
-  int req_size = 0, name_len = 0, alias_print_len = 0;
+  int req_size = 0, name_len = 0, alias_print_len = 0, share_key_len = 0;
   SHA1Hash alias_sha1 = SHA1_HASH_INITIALIZER;
 
   reply = OR_ALIGNED_BUF_START (a_reply);
@@ -4972,6 +4975,8 @@ csession_create_prepared_statement (const char *name, const char *alias_print, c
       /* sha1 */
       req_size += OR_SHA1_SIZE;
     }
+  /* packed size for share_key */
+  req_size += length_const_string (share_key, &share_key_len);
 
   request = (char *) malloc (req_size);
   if (request == NULL)
@@ -4998,6 +5003,8 @@ csession_create_prepared_statement (const char *name, const char *alias_print, c
 	}
       ptr = or_pack_sha1 (ptr, &alias_sha1);
     }
+  /* share_key */
+  ptr = pack_const_string_with_length (ptr, share_key, share_key_len);
 
   req_error =
     net_client_request (NET_SERVER_SES_CREATE_PREPARED_STATEMENT, request, req_size, reply,
@@ -5109,6 +5116,61 @@ error:
 #endif
 }
 
+/*
+ * csession_attach_shared_prepared_statement () - prepare a session statement from one already prepared by another
+ *						  session with the same share key
+ * return	  : error code or NO_ERROR
+ * name (in)	  : the name of the prepared statement
+ * share_key (in) : the key the statement was shared with
+ * found (out)	  : true if the statement was prepared, false if it must be compiled
+ */
+int
+csession_attach_shared_prepared_statement (const char *name, const char *share_key, bool * found)
+{
+#if defined (CS_MODE)
+  int req_error;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  char *request = NULL;
+  char *ptr = NULL;
+  int req_size, name_len, share_key_len;
+  int is_found = 0;
+
+  *found = false;
+
+  req_size = length_const_string (name, &name_len);
+  req_size += length_const_string (share_key, &share_key_len);
+
+  request = (char *) malloc (req_size);
+  if (request == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) req_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  ptr = pack_const_string_with_length (request, name, name_len);
+  ptr = pack_const_string_with_length (ptr, share_key, share_key_len);
+
+  req_error =
+    net_client_request (NET_SERVER_SES_ATTACH_SHARED_PREPARED_STATEMENT, request, req_size, reply,
+			OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, NULL, 0);
+  free_and_init (request);
+  if (req_error != NO_ERROR)
+    {
+      return req_error;
+    }
+
+  ptr = or_unpack_int (reply, &req_error);
+  ptr = or_unpack_int (ptr, &is_found);
+  *found = (req_error == NO_ERROR && is_found != 0);
+
+  return req_error;
+#else
+  *found = false;
+  return NO_ERROR;
+#endif
+}
+
 /*
  * csession_get_prepared_statement () - get information about a prepared session statement
  * return	       : error code or no error
@@ -6866,24 +6928,60 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
   int error = ER_NET_CLIENT_DATA_RECEIVE;
   int req_error;
   char *ptr;
-  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_request;
+  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE * 3) a_request;
   char *request;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  int request_size;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
   char *reply;
+  int reply_size;
+  char compressed_buf[IO_MAX_PAGE_SIZE];
+  int page_size = 0;
+  bool is_compression_negotiated;
 
   request = OR_ALIGNED_BUF_START (a_request);
   reply = OR_ALIGNED_BUF_START (a_reply);
 
+  /* the compression flag and the size before compression are exchanged only with a server that advertised them;
+   * an older server gets the request and sends the reply it knows */
+  is_compression_negotiated = net_client_server_has_capability (NET_CAP_LIST_PAGE_COMPRESSION);
+  request_size = OR_PTR_SIZE + OR_INT_SIZE * 2;
+  reply_size = OR_INT_SIZE * 2;
+
   ptr = or_pack_ptr (request, query_id);
   ptr = or_pack_int (ptr, (int) volid);
   ptr = or_pack_int (ptr, (int) pageid);
+  if (is_compression_negotiated)
+    {
+      ptr = or_pack_int (ptr, prm_get_bool_value (PRM_ID_LIST_FILE_PAGE_COMPRESSION) ? 1 : 0);
+      request_size += OR_INT_SIZE;
+      reply_size += OR_INT_SIZE;
+    }
 
   req_error =
-    net_client_request2_no_malloc (NET_SERVER_LS_GET_LIST_FILE_PAGE, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
-				   OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, buffer, buffer_size);
+    net_client_request2_no_malloc (NET_SERVER_LS_GET_LIST_FILE_PAGE, request, request_size, reply, reply_size, NULL, 0,
+				   buffer, buffer_size);
   if (!req_error)
     {
       ptr = or_unpack_int (&reply[OR_INT_SIZE], &error);
+      if (is_compression_negotiated)
+	{
+	  ptr = or_unpack_int (ptr, &page_size);
+	}
+
+      if (page_size > 0)
+	{
+	  /* the page was sent compressed; it is always smaller than the page, so it was received in place */
+	  assert (*buffer_size < page_size && page_size <= IO_MAX_PAGE_SIZE);
+
+	  memcpy (compressed_buf, buffer, *buffer_size);
+	  if (LZ4_decompress_safe (compressed_buf, buffer, *buffer_size, IO_MAX_PAGE_SIZE) != page_size)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_CLIENT_DATA_RECEIVE, 0);
+	      *buffer_size = 0;
+	      return ER_NET_CLIENT_DATA_RECEIVE;
+	    }
+	  *buffer_size = page_size;
+	}
     }
 
   return error;
@@ -7146,6 +7244,14 @@ qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt
 	}
     }
 
+  if (!IS_QUERY_EXECUTE_WITH_COMMIT (flag) && net_Deferred_end_queries_count > 0
+      && net_client_server_has_capability (NET_CAP_END_QUERIES_ON_EXECUTE))
+    {
+      /* send the deferred end queries along with this request rather than in a separate one. An older server would
+       * not expect them; they are sent with separate end query requests to it. */
+      flag |= EXECUTE_QUERY_WITH_END_QUERIES;
+    }
+
   /* pack XASL file id (XASL_ID), number of parameter values, size of the send data, and query execution mode flag as a
    * request data */
   ptr = request;
@@ -7157,7 +7263,7 @@ qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt
   ptr = or_pack_int (ptr, query_timeout);
 
   request_len = OR_XASL_ID_SIZE + OR_INT_SIZE * 4 + OR_CACHE_TIME_SIZE;
-  if (IS_QUERY_EXECUTE_WITH_COMMIT (flag))
+  if (IS_QUERY_EXECUTE_WITH_COMMIT (flag) || IS_QUERY_EXECUTE_WITH_END_QUERIES (flag))
     {
       assert (net_Deferred_end_queries_count <= NET_DEFER_END_QUERIES_MAX);
       ptr = or_pack_int (ptr, net_Deferred_end_queries_count);
@@ -7215,6 +7321,12 @@ qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt
 
   if (!req_error)
     {
+      if (IS_QUERY_EXECUTE_WITH_END_QUERIES (flag))
+	{
+	  /* the server ended the deferred queries before executing this one */
+	  net_Deferred_end_queries_count = 0;
+	}
+
       /* first argument should be QUERY_END ptr = or_unpack_int(reply, &status); */
       /* second argument should be the same with replydata_size_listid ptr = or_unpack_int(ptr, &listid_length); */
       /* third argument should be the same with replydata_size_page ptr = or_unpack_int(ptr, &page_size); */
@@ -373,6 +373,7 @@ extern int net_client_send_data (char *host, unsigned int rc, char *databuf, int
 extern int net_client_receive_action (int rc, int *action);
 
 extern char *net_client_get_server_host (void);
+extern bool net_client_server_has_capability (int capability);
 extern char *net_client_get_server_name (void);
 
 extern int boot_compact_classes (OID ** class_oids, int num_classes, int space_to_process, int instance_lock_timeout,
@@ -407,8 +408,9 @@ extern int csession_set_row_count (int rows);
 extern int csession_get_row_count (int *rows);
 extern int csession_get_last_insert_id (DB_VALUE * value, bool update_last_insert_id);
 extern int csession_reset_cur_insert_id (void);
+extern int csession_attach_shared_prepared_statement (const char *name, const char *share_key, bool * found);
 extern int csession_create_prepared_statement (const char *name, const char *alias_print, char *stmt_info,
-					       int info_length);
+					       int info_length, const char *share_key);
 extern int csession_get_prepared_statement (const char *name, XASL_ID * xasl_id, char **stmt_info,
 					    xasl_node_header * xasl_header_p);
 
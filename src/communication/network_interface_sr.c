@@ -88,6 +88,7 @@
 #include "log_manager.h"
 #include "crypt_opfunc.h"
 #include "flashback.h"
+#include "lz4.h"
 #if defined (SUPPRESS_STRLEN_WARNING)
 #define strlen(s1)  ((int) strlen(s1))
 #endif /* defined (SUPPRESS_STRLEN_WARNING) */
@@ -422,6 +423,8 @@ server_capabilities (void)
   int capabilities = 0;
 
   capabilities |= NET_CAP_INTERRUPT_ENABLED;
+  capabilities |= NET_CAP_END_QUERIES_ON_EXECUTE;
+  capabilities |= NET_CAP_LIST_PAGE_COMPRESSION;
   if (db_Disable_modifications > 0)
     {
       capabilities |= NET_CAP_UPDATE_DISABLED;
@@ -621,6 +624,7 @@ server_ping_with_handshake (THREAD_ENTRY * thread_p, unsigned int rid, char *req
     {
       thread_p->conn_entry->client_type = (BOOT_CLIENT_TYPE) client_type;
     }
+  thread_p->conn_entry->client_capabilities = client_capabilities;
 
   reply_size = (or_packed_string_length (server_release, &strlen1) + (OR_INT_SIZE * 3)
 		+ or_packed_string_length (boot_Host_name, &strlen2));
@@ -4751,25 +4755,39 @@ sdk_vlabel (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen
  *   request(in):
  *   reqlen(in):
  *
- * NOTE:
+ * NOTE: If the client accepts it, the page is sent LZ4 compressed whenever that makes it smaller. The reply carries
+ *       the size of the data sent, the error and the size of the page before compression (0 if not compressed).
+ *       Clients that did not advertise NET_CAP_LIST_PAGE_COMPRESSION send no compression flag and get the reply
+ *       without the size before compression.
  */
 void
 sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
   QUERY_ID query_id;
-  int volid, pageid;
+  int volid, pageid, accept_compression = 0;
   char *ptr;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
+  int reply_size;
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_page_buf;
-  int page_size;
+  char compressed_buf[LZ4_COMPRESSBOUND (IO_MAX_PAGE_SIZE)];
+  int page_size, compressed_size;
   int error = NO_ERROR;
+  bool is_compression_negotiated;
 
   aligned_page_buf = PTR_ALIGN (page_buf, MAX_ALIGNMENT);
 
+  /* only a client that advertised it sends the compression flag and expects the size before compression */
+  is_compression_negotiated = (thread_p->conn_entry->client_capabilities & NET_CAP_LIST_PAGE_COMPRESSION) != 0;
+  reply_size = is_compression_negotiated ? OR_INT_SIZE * 3 : OR_INT_SIZE * 2;
+
   ptr = or_unpack_ptr (request, &query_id);
   ptr = or_unpack_int (ptr, &volid);
   ptr = or_unpack_int (ptr, &pageid);
+  if (is_compression_negotiated)
+    {
+      ptr = or_unpack_int (ptr, &accept_compression);
+    }
 
   if (volid == NULL_VOLID && pageid == NULL_PAGEID)
     {
@@ -4788,10 +4806,29 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
       goto empty_page;
     }
 
+  if (accept_compression)
+    {
+      compressed_size =
+	LZ4_compress_default (aligned_page_buf, compressed_buf, page_size, (int) sizeof (compressed_buf));
+      if (compressed_size > 0 && compressed_size < page_size)
+	{
+	  ptr = or_pack_int (reply, compressed_size);
+	  ptr = or_pack_int (ptr, error);
+	  ptr = or_pack_int (ptr, page_size);
+	  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, reply_size, compressed_buf,
+					     compressed_size);
+	  return;
+	}
+      /* not worth it; send the page as it is */
+    }
+
   ptr = or_pack_int (reply, page_size);
   ptr = or_pack_int (ptr, error);
-  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
-				     page_size);
+  if (is_compression_negotiated)
+    {
+      ptr = or_pack_int (ptr, 0);
+    }
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, reply_size, aligned_page_buf, page_size);
   return;
 
 empty_page:
@@ -4800,8 +4837,11 @@ empty_page:
   page_size = QFILE_PAGE_HEADER_SIZE;
   ptr = or_pack_int (reply, page_size);
   ptr = or_pack_int (ptr, error);
-  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
-				     page_size);
+  if (is_compression_negotiated)
+    {
+      ptr = or_pack_int (ptr, 0);
+    }
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, reply_size, aligned_page_buf, page_size);
 }
 
 /*
@@ -5193,7 +5233,7 @@ sqmgr_execute_query (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
   is_tran_auto_commit = IS_TRAN_AUTO_COMMIT (query_flag);
   xsession_set_tran_auto_commit (thread_p, is_tran_auto_commit);
 
-  if (IS_QUERY_EXECUTE_WITH_COMMIT (query_flag))
+  if (IS_QUERY_EXECUTE_WITH_COMMIT (query_flag) || IS_QUERY_EXECUTE_WITH_END_QUERIES (query_flag))
     {
       ptr = or_unpack_int (ptr, &n_query_ids);
       if (n_query_ids + 1 > NET_DEFER_END_QUERIES_MAX)
@@ -5214,6 +5254,21 @@ sqmgr_execute_query (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
 	}
     }
 
+  if (IS_QUERY_EXECUTE_WITH_END_QUERIES (query_flag))
+    {
+      /* the client piggybacked the queries it has done with; end them now instead of on a separate request */
+      for (i = 0; i < n_query_ids; i++)
+	{
+	  if (p_net_Deferred_end_queries[i] > 0 && xqmgr_end_query (thread_p, p_net_Deferred_end_queries[i]) != NO_ERROR)
+	    {
+	      /* the query may be gone already; it is cleared at the end of the transaction anyway */
+	      er_clear ();
+	    }
+	}
+      n_query_ids = 0;
+      query_flag &= ~EXECUTE_QUERY_WITH_END_QUERIES;
+    }
+
   if (IS_QUERY_EXECUTED_WITHOUT_DATA_BUFFERS (query_flag))
     {
       assert (data_size < EXECUTE_QUERY_MAX_ARGUMENT_DATA_SIZE);
@@ -9099,6 +9154,7 @@ ssession_create_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, c
 {
   /* request data */
   char *name = NULL, *alias_print = NULL;
+  char *share_key = NULL;
   char *reply = NULL, *ptr = NULL;
   char *data_request = NULL;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
@@ -9125,6 +9181,8 @@ ssession_create_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, c
       /* alias_sha1 */
       ptr = or_unpack_sha1 (ptr, &alias_sha1);
     }
+  /* share key */
+  ptr = or_unpack_string_nocopy (ptr, &share_key);
 
   err = css_receive_data_from_client (thread_p->conn_entry, rid, &data_request, &data_size);
   if (err != NO_ERROR)
@@ -9145,6 +9203,16 @@ ssession_create_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, c
     }
   memcpy (info, data_request, data_size);
 
+  if (share_key != NULL && alias_print != NULL)
+    {
+      /* failing to share the statement must not fail the prepare */
+      if (xsession_share_prepared_statement (thread_p, share_key, alias_print, &alias_sha1, info, data_size)
+	  != NO_ERROR)
+	{
+	  er_clear ();
+	}
+    }
+
   err = xsession_create_prepared_statement (thread_p, name, alias_print, &alias_sha1, info, data_size);
 
   if (err != NO_ERROR)
@@ -9324,6 +9392,46 @@ ssession_delete_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, c
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
 }
 
+/*
+ * ssession_attach_shared_prepared_statement - prepare a statement from one shared by another session
+ * return: error code or NO_ERROR
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ */
+void
+ssession_attach_shared_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  int err = NO_ERROR;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  char *ptr;
+  char *name = NULL, *key = NULL;
+  bool found = false;
+
+  ptr = or_unpack_string_nocopy (request, &name);
+  ptr = or_unpack_string_nocopy (ptr, &key);
+  if (name == NULL || key == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+      (void) return_error_to_client (thread_p, rid);
+      err = ER_NET_SERVER_DATA_RECEIVE;
+    }
+  else
+    {
+      err = xsession_attach_shared_prepared_statement (thread_p, name, key, &found);
+      if (err != NO_ERROR)
+	{
+	  (void) return_error_to_client (thread_p, rid);
+	}
+    }
+
+  ptr = or_pack_int (reply, err);
+  ptr = or_pack_int (ptr, found ? 1 : 0);
+
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
+}
+
 /*
  * slogin_user - login user
  * return: error code or NO_ERROR
@@ -632,6 +632,9 @@ net_server_init (void)
   req_p = &net_Requests[NET_SERVER_SES_DELETE_PREPARED_STATEMENT];
   req_p->processing_function = ssession_delete_prepared_statement;
 
+  req_p = &net_Requests[NET_SERVER_SES_ATTACH_SHARED_PREPARED_STATEMENT];
+  req_p->processing_function = ssession_attach_shared_prepared_statement;
+
   req_p = &net_Requests[NET_SERVER_SES_SET_SESSION_VARIABLES];
   req_p->processing_function = ssession_set_session_variables;
 
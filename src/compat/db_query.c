@@ -2960,6 +2960,40 @@ db_query_get_tuple_value (DB_QUERY_RESULT * result, int index, DB_VALUE * value)
   return (retval);
 }
 
+/*
+ * db_query_peek_tuple_value_bytes() - This function is used to peek the stored
+ *    representation of a column in the current tuple of a query result,
+ *    without converting it into a DB_VALUE.
+ * return : error code
+ * result(in): Pointer to the query result structure
+ * index(in): Index of the desired column
+ * type(out): Type of the column, DB_TYPE_UNKNOWN if the result has no
+ *            stored representation to peek (use db_query_get_tuple_value)
+ * bytes(out): Column value inside the cursor buffer, NULL if it is NULL
+ */
+int
+db_query_peek_tuple_value_bytes (DB_QUERY_RESULT * result, int index, DB_TYPE * type, const char **bytes)
+{
+  CHECK_CONNECT_ERROR ();
+  CHECK_3ARGS_ERROR (result, type, bytes);
+
+  *type = DB_TYPE_UNKNOWN;
+  *bytes = NULL;
+
+  if (result->status == T_CLOSED)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_OPR_ON_CLOSED_QRES, 0);
+      return ER_QPROC_OPR_ON_CLOSED_QRES;
+    }
+
+  if (result->type != T_SELECT)
+    {
+      return NO_ERROR;
+    }
+
+  return cursor_peek_tuple_value_bytes (&result->res.s.cursor_id, index, type, bytes);
+}
+
 /*
  * db_query_get_tuple_value_by_name() - This function is used to get the value
  *    for a column in the current tuple of a query result. The current tuple is
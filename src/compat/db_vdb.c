@@ -2295,6 +2295,48 @@ char_array_to_name_list (PARSER_CONTEXT * parser, char **names, int length)
   return list;
 }
 
+/*
+ * do_get_prepared_statement_share_key () - build the key under which a prepared statement is shared with the
+ *					    other sessions of the server
+ * return : the key (must be freed by the caller) or NULL if the statement is not to be shared
+ * session (in)	  : client session for this statement
+ * statement_literal (in) : the statement text
+ *
+ * Note: Everything that changes how the text compiles must be part of the
+ *	 key: the user, the OID inclusion and the query string parameters.
+ */
+static char *
+do_get_prepared_statement_share_key (DB_SESSION * session, const char *statement_literal)
+{
+  const char *user_name;
+  char *params = NULL;
+  char *key = NULL;
+  size_t key_size;
+
+  user_name = au_user_name ();
+  if (user_name == NULL)
+    {
+      return NULL;
+    }
+
+  params = sysprm_print_parameters_for_qry_string ();
+
+  key_size = strlen (user_name) + (params != NULL ? strlen (params) : 0) + strlen (statement_literal) + 8;
+  key = (char *) malloc (key_size);
+  if (key != NULL)
+    {
+      snprintf (key, key_size, "%s\n%d\n%s\n%s", user_name, session->include_oid ? 1 : 0,
+		params != NULL ? params : "", statement_literal);
+    }
+
+  if (params != NULL)
+    {
+      free_and_init (params);
+    }
+
+  return key;
+}
+
 /*
  * do_process_prepare_statement () - execute a 'PREPARE STMT FROM ...'
  *				     statement
@@ -2314,9 +2356,25 @@ do_process_prepare_statement (DB_SESSION * session, PT_NODE * statement)
   int err = NO_ERROR;
   char *stmt_info = NULL;
   int info_len = 0;
+  char *share_key = NULL;
+  bool found = false;
   assert (statement->node_type == PT_PREPARE_STATEMENT);
   db_init_prepare_info (&prepare_info);
 
+  /* another session may have prepared the same statement already; take it from the server instead of compiling */
+  share_key = do_get_prepared_statement_share_key (session, statement_literal);
+  if (share_key != NULL)
+    {
+      if (csession_attach_shared_prepared_statement (name, share_key, &found) != NO_ERROR)
+	{
+	  er_clear ();
+	}
+      else if (found)
+	{
+	  goto cleanup;
+	}
+    }
+
   prepared_session = db_open_buffer_local (statement_literal);
   if (prepared_session == NULL)
     {
@@ -2398,7 +2456,7 @@ do_process_prepare_statement (DB_SESSION * session, PT_NODE * statement)
     }
   info_len = err;
 
-  err = csession_create_prepared_statement (name, prepared_stmt->alias_print, stmt_info, info_len);
+  err = csession_create_prepared_statement (name, prepared_stmt->alias_print, stmt_info, info_len, share_key);
 
 cleanup:
   if (err < 0 && name != NULL)
@@ -2414,6 +2472,11 @@ cleanup:
       free_and_init (stmt_info);
     }
 
+  if (share_key != NULL)
+    {
+      free_and_init (share_key);
+    }
+
   if (prepared_session)
     {
       db_close_session_local (prepared_session);
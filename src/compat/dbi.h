@@ -549,6 +549,8 @@ extern "C"
   extern int db_query_last_tuple (DB_QUERY_RESULT * result);
   extern int db_query_get_tuple_value_by_name (DB_QUERY_RESULT * result, char *column_name, DB_VALUE * value);
   extern int db_query_get_tuple_value (DB_QUERY_RESULT * result, int tuple_index, DB_VALUE * value);
+  extern int db_query_peek_tuple_value_bytes (DB_QUERY_RESULT * result, int index, DB_TYPE * type,
+					      const char **bytes);
 
   extern int db_query_get_tuple_oid (DB_QUERY_RESULT * result, DB_VALUE * db_value);
 
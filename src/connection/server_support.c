@@ -93,6 +93,10 @@
 
 #define RMUTEX_NAME_TEMP_CONN_ENTRY "TEMP_CONN_ENTRY"
 
+/* poll timeouts of the connection handler; the timeout doubles while the connection stays idle */
+#define CSS_CONN_POLL_TIMEOUT_MIN 100	/* msec */
+#define CSS_CONN_POLL_TIMEOUT_MAX 1000	/* msec */
+
 static bool css_Server_shutdown_inited = false;
 static struct timeval css_Shutdown_timeout = { 0, 0 };
 
@@ -976,7 +980,8 @@ css_reestablish_connection_to_master (void)
  *   return:
  *   arg(in):
  *
- * Note: One server thread per one client
+ * Note: One server thread per one client. Idle connections back off their poll timeout up to
+ *       CSS_CONN_POLL_TIMEOUT_MAX, so that thousands of idle clients do not wake up the server ten times a second.
  */
 static int
 css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
@@ -984,7 +989,7 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
   int n, type, rv, status;
   volatile int conn_status;
   int css_peer_alive_timeout, poll_timeout;
-  int max_num_loop, num_loop;
+  int idle_time;
   SOCKET fd;
   struct pollfd po[1] = { {0, 0, 0} };
 
@@ -1000,9 +1005,8 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
   thread_p->type = TT_SERVER;	/* server thread */
 
   css_peer_alive_timeout = 5000;
-  poll_timeout = 100;
-  max_num_loop = css_peer_alive_timeout / poll_timeout;
-  num_loop = 0;
+  poll_timeout = CSS_CONN_POLL_TIMEOUT_MIN;
+  idle_time = 0;
 
   status = NO_ERRORS;
   /* check if socket has error or client is down */
@@ -1039,12 +1043,13 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
       n = poll (po, 1, poll_timeout);
       if (n == 0)
 	{
-	  if (num_loop < max_num_loop)
+	  idle_time += poll_timeout;
+	  poll_timeout = MIN (poll_timeout * 2, CSS_CONN_POLL_TIMEOUT_MAX);
+	  if (idle_time < css_peer_alive_timeout)
 	    {
-	      num_loop++;
 	      continue;
 	    }
-	  num_loop = 0;
+	  idle_time = 0;
 
 #if !defined (WINDOWS)
 	  /* 0 means it timed out and no fd is changed. */
@@ -1070,7 +1075,7 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
 	}
       else if (n < 0)
 	{
-	  num_loop = 0;
+	  idle_time = 0;
 
 	  if (errno == EINTR)
 	    {
@@ -1085,7 +1090,8 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
 	}
       else
 	{
-	  num_loop = 0;
+	  idle_time = 0;
+	  poll_timeout = CSS_CONN_POLL_TIMEOUT_MIN;
 
 	  if (po[0].revents & POLLERR || po[0].revents & POLLHUP)
 	    {
@@ -1029,21 +1029,25 @@ chksum_print_pk_list (PARSER_CONTEXT * parser, DB_CONSTRAINT * pk, int *pk_col_c
  *   pk_list(in):
  *   pk_orderby(in): pk column list used for ORDER BY
  *   prev_lower_bound(in):
- *   limit(in): number used for LIMIT
+ *   limit(in): position of the row to select in pk order
+ *
+ * Note: Only the limit-th row is selected (LIMIT limit - 1, 1), so the rows
+ *       before it are skipped by the server instead of being sent here.
  */
 static PARSER_VARCHAR *
 chksum_print_select_last_chunk (PARSER_CONTEXT * parser, const char *table_name, PARSER_VARCHAR * pk_list,
 				PARSER_VARCHAR * pk_orderby, PARSER_VARCHAR * prev_lower_bound, int limit)
 {
   PARSER_VARCHAR *buffer = NULL;
-  char limit_str[15];
+  char limit_str[32];
 
   if (parser == NULL)
     {
       return NULL;
     }
 
-  sprintf (limit_str, "%d", limit);
+  assert (limit > 0);
+  sprintf (limit_str, "%d, 1", limit - 1);
 
   buffer = pt_append_nulstring (parser, buffer, "SELECT ");
   buffer = pt_append_varchar (parser, buffer, pk_list);
@@ -1344,7 +1348,7 @@ chksum_get_next_lower_bound (PARSER_CONTEXT * parser, const char *table_name, DB
   query = (const char *) pt_get_varchar_bytes (select_last_chunk);
   res = db_execute (query, &query_result, &query_error);
 
-  if (prev_lower_bound != NULL && res < chunk_size)
+  if (prev_lower_bound != NULL && res == 0)
     {
       /* no more chunk to process */
       db_query_end (query_result);
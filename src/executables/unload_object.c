@@ -162,6 +162,8 @@ static int64_t total_approximate_class_objects = 0;
 
 
 #define OBJECT_SUFFIX "_objects"
+#define CSV_SUFFIX ".csv"
+#define CSV_VALUE_BUFFER_SIZE 400	/* bigger than DBL_MAX_DIGITS and any date/time string */
 
 #define HEADER_FORMAT 	"-------------------------------+--------------------------------\n""    %-25s  |  %23s \n""-------------------------------+--------------------------------\n"
 #define MSG_FORMAT 		"    %-25s  |  %10ld (%3d%% / %5d%%)"
@@ -179,6 +181,9 @@ static int process_class (extract_context & ctxt, int cl_no);
 static int process_object (DESC_OBJ * desc_obj, OID * obj_oid, int referenced_class);
 static int process_set (DB_SET * set);
 static int process_value (DB_VALUE * value);
+static int process_class_header (extract_context & ctxt, SM_CLASS * class_ptr);
+static int process_csv_header (SM_CLASS * class_ptr);
+static int process_csv_value (DB_VALUE * value);
 static void update_hash (OID * object_oid, OID * class_oid, int *data);
 static DB_OBJECT *is_class (OID * obj_oid, OID * class_oid);
 static int all_classes_processed (void);
@@ -932,7 +937,7 @@ extract_objects (extract_context & ctxt, const char *output_dirname)
 		    }
 
 		  snprintf (outfile, PATH_MAX - 1, "%s/%s_%s%s", output_dirname, ctxt.output_prefix,
-			    sm_ch_name ((MOBJ) class_ptr), OBJECT_SUFFIX);
+			    sm_ch_name ((MOBJ) class_ptr), csv_format ? CSV_SUFFIX : OBJECT_SUFFIX);
 
 		  obj_out->fp = fopen_ex (outfile, "wb");
 		  if (obj_out->fp == NULL)
@@ -1066,11 +1071,7 @@ process_class (extract_context & ctxt, int cl_no)
   int error = NO_ERROR;
   DB_OBJECT *class_ = class_table->mops[cl_no];
   int i = 0;
-  int v = 0;
   SM_CLASS *class_ptr;
-  char owner_name[DB_MAX_IDENTIFIER_LENGTH] = { '\0' };
-  char *class_name = NULL;
-  SM_ATTRIBUTE *attribute;
   LC_COPYAREA *fetch_area;	/* Area where objects are received */
   HFID *hfid;
   OID *class_oid;
@@ -1090,7 +1091,6 @@ process_class (extract_context & ctxt, int cl_no)
   time_t start = 0;
 #endif
   int total;
-  char output_owner[DB_MAX_USER_LENGTH + 4] = { '\0' };
 
   LC_FETCH_VERSION_TYPE fetch_type = latest_image_flag ? LC_FETCH_CURRENT_VERSION : LC_FETCH_MVCC_VERSION;
 
@@ -1125,134 +1125,18 @@ process_class (extract_context & ctxt, int cl_no)
 
   class_oid = ws_oid (class_);
 
-  v = 0;
-  for (attribute = class_ptr->shared; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
-    {
-
-      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
-	{
-	  continue;
-	}
-      if (v == 0)
-	{
-	  SPLIT_USER_SPECIFIED_NAME (sm_ch_name ((MOBJ) class_ptr), owner_name, class_name);
-
-	  PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner,
-			    sizeof (output_owner));
-
-	  CHECK_PRINT_ERROR (text_print
-			     (obj_out, NULL, 0, "%cclass %s%s%s%s shared (%s%s%s", '%',
-			      output_owner, PRINT_IDENTIFIER (class_name), PRINT_IDENTIFIER (attribute->header.name)));
-	}
-      else
-	{
-	  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, ", %s%s%s", PRINT_IDENTIFIER (attribute->header.name)));
-	}
-
-      ++v;
-    }
-  if (v)
-    {
-      CHECK_PRINT_ERROR (text_print (obj_out, ")\n", 2, NULL));
-    }
-
-  v = 0;
-  for (attribute = class_ptr->shared; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
-    {
-      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
-	{
-	  continue;
-	}
-      if (v)
-	{
-	  CHECK_PRINT_ERROR (text_print (obj_out, " ", 1, NULL));
-	}
-      error = process_value (&attribute->default_value.value);
-      if (error != NO_ERROR)
-	{
-	  if (!ignore_err_flag)
-	    goto exit_on_error;
-	}
-
-      ++v;
-    }
-  if (v)
-    {
-      CHECK_PRINT_ERROR (text_print (obj_out, "\n", 1, NULL));
-    }
-
-  v = 0;
-  for (attribute = class_ptr->class_attributes; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+  if (csv_format)
     {
-      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
-	{
-	  continue;
-	}
-      if (v == 0)
-	{
-	  SPLIT_USER_SPECIFIED_NAME (sm_ch_name ((MOBJ) class_ptr), owner_name, class_name);
-
-	  PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner,
-			    sizeof (output_owner));
-
-	  CHECK_PRINT_ERROR (text_print
-			     (obj_out, NULL, 0, "%cclass %s%s%s%s class (%s%s%s", '%',
-			      output_owner, PRINT_IDENTIFIER (class_name), PRINT_IDENTIFIER (attribute->header.name)));
-	}
-      else
-	{
-	  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, ", %s%s%s", PRINT_IDENTIFIER (attribute->header.name)));
-	}
-      ++v;
+      error = process_csv_header (class_ptr);
     }
-  if (v)
+  else
     {
-      CHECK_PRINT_ERROR (text_print (obj_out, ")\n", 2, NULL));
+      error = process_class_header (ctxt, class_ptr);
     }
-
-  v = 0;
-  for (attribute = class_ptr->class_attributes; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+  if (error != NO_ERROR)
     {
-
-      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
-	{
-	  continue;
-	}
-      if (v)
-	{
-	  CHECK_PRINT_ERROR (text_print (obj_out, " ", 1, NULL));
-	}
-      if ((error = process_value (&attribute->default_value.value)) != NO_ERROR)
-	{
-	  if (!ignore_err_flag)
-	    {
-	      goto exit_on_error;
-	    }
-	}
-
-      ++v;
-    }
-
-  SPLIT_USER_SPECIFIED_NAME (sm_ch_name ((MOBJ) class_ptr), owner_name, class_name);
-
-  PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner, sizeof (output_owner));
-
-  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, (v) ? "\n%cclass %s%s%s%s ("	/* new line */
-				 : "%cclass %s%s%s%s (", '%', output_owner, PRINT_IDENTIFIER (class_name)));
-
-  v = 0;
-  attribute = class_ptr->ordered_attributes;
-  while (attribute)
-    {
-      if (attribute->header.name_space == ID_ATTRIBUTE)
-	{
-	  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, (v) ? " %s%s%s"	/* space */
-					 : "%s%s%s", PRINT_IDENTIFIER (attribute->header.name)));
-	  ++v;
-	}
-      attribute = (SM_ATTRIBUTE *) attribute->order_link;
+      goto exit_on_error;
     }
-  CHECK_PRINT_ERROR (text_print (obj_out, ")\n", 2, NULL));
 
   /* Find the heap where the instances are stored */
   hfid = sm_ch_heap ((MOBJ) class_ptr);
@@ -1437,6 +1321,203 @@ exit_on_error:
 
 }
 
+/*
+ * process_class_header - dump the shared and class attribute values and the %class line of a class
+ *    return: NO_ERROR, if successful, error number, if not successful.
+ *    ctxt(in): extract context
+ *    class_ptr(in): class
+ */
+static int
+process_class_header (extract_context & ctxt, SM_CLASS * class_ptr)
+{
+  int error = NO_ERROR;
+  int v = 0;
+  char owner_name[DB_MAX_IDENTIFIER_LENGTH] = { '\0' };
+  char *class_name = NULL;
+  SM_ATTRIBUTE *attribute;
+  char output_owner[DB_MAX_USER_LENGTH + 4] = { '\0' };
+
+  v = 0;
+  for (attribute = class_ptr->shared; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+    {
+
+      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
+	{
+	  continue;
+	}
+      if (v == 0)
+	{
+	  SPLIT_USER_SPECIFIED_NAME (sm_ch_name ((MOBJ) class_ptr), owner_name, class_name);
+
+	  PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner,
+			    sizeof (output_owner));
+
+	  CHECK_PRINT_ERROR (text_print
+			     (obj_out, NULL, 0, "%cclass %s%s%s%s shared (%s%s%s", '%',
+			      output_owner, PRINT_IDENTIFIER (class_name), PRINT_IDENTIFIER (attribute->header.name)));
+	}
+      else
+	{
+	  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, ", %s%s%s", PRINT_IDENTIFIER (attribute->header.name)));
+	}
+
+      ++v;
+    }
+  if (v)
+    {
+      CHECK_PRINT_ERROR (text_print (obj_out, ")\n", 2, NULL));
+    }
+
+  v = 0;
+  for (attribute = class_ptr->shared; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+    {
+      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
+	{
+	  continue;
+	}
+      if (v)
+	{
+	  CHECK_PRINT_ERROR (text_print (obj_out, " ", 1, NULL));
+	}
+      error = process_value (&attribute->default_value.value);
+      if (error != NO_ERROR)
+	{
+	  if (!ignore_err_flag)
+	    goto exit_on_error;
+	}
+
+      ++v;
+    }
+  if (v)
+    {
+      CHECK_PRINT_ERROR (text_print (obj_out, "\n", 1, NULL));
+    }
+
+  v = 0;
+  for (attribute = class_ptr->class_attributes; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+    {
+      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
+	{
+	  continue;
+	}
+      if (v == 0)
+	{
+	  SPLIT_USER_SPECIFIED_NAME (sm_ch_name ((MOBJ) class_ptr), owner_name, class_name);
+
+	  PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner,
+			    sizeof (output_owner));
+
+	  CHECK_PRINT_ERROR (text_print
+			     (obj_out, NULL, 0, "%cclass %s%s%s%s class (%s%s%s", '%',
+			      output_owner, PRINT_IDENTIFIER (class_name), PRINT_IDENTIFIER (attribute->header.name)));
+	}
+      else
+	{
+	  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, ", %s%s%s", PRINT_IDENTIFIER (attribute->header.name)));
+	}
+      ++v;
+    }
+  if (v)
+    {
+      CHECK_PRINT_ERROR (text_print (obj_out, ")\n", 2, NULL));
+    }
+
+  v = 0;
+  for (attribute = class_ptr->class_attributes; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+    {
+
+      if (DB_VALUE_TYPE (&attribute->default_value.value) == DB_TYPE_NULL)
+	{
+	  continue;
+	}
+      if (v)
+	{
+	  CHECK_PRINT_ERROR (text_print (obj_out, " ", 1, NULL));
+	}
+      if ((error = process_value (&attribute->default_value.value)) != NO_ERROR)
+	{
+	  if (!ignore_err_flag)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+
+      ++v;
+    }
+
+  SPLIT_USER_SPECIFIED_NAME (sm_ch_name ((MOBJ) class_ptr), owner_name, class_name);
+
+  PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner, sizeof (output_owner));
+
+  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, (v) ? "\n%cclass %s%s%s%s ("	/* new line */
+				 : "%cclass %s%s%s%s (", '%', output_owner, PRINT_IDENTIFIER (class_name)));
+
+  v = 0;
+  attribute = class_ptr->ordered_attributes;
+  while (attribute)
+    {
+      if (attribute->header.name_space == ID_ATTRIBUTE)
+	{
+	  CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, (v) ? " %s%s%s"	/* space */
+					 : "%s%s%s", PRINT_IDENTIFIER (attribute->header.name)));
+	  ++v;
+	}
+      attribute = (SM_ATTRIBUTE *) attribute->order_link;
+    }
+  CHECK_PRINT_ERROR (text_print (obj_out, ")\n", 2, NULL));
+
+exit_on_end:
+
+  return error;
+
+exit_on_error:
+
+  CHECK_EXIT_ERROR (error);
+  goto exit_on_end;
+}
+
+/*
+ * process_csv_header - dump the header row of the CSV file of a class
+ *    return: NO_ERROR, if successful, error number, if not successful.
+ *    class_ptr(in): class
+ * Note:
+ *    The header row holds the attribute names, in the order the values of
+ *    each row are written by process_object.
+ */
+static int
+process_csv_header (SM_CLASS * class_ptr)
+{
+  int error = NO_ERROR;
+  SM_ATTRIBUTE *attribute;
+  int v = 0;
+
+  for (attribute = class_ptr->ordered_attributes; attribute; attribute = attribute->order_link)
+    {
+      if (attribute->header.name_space != ID_ATTRIBUTE)
+	{
+	  continue;
+	}
+
+      if (v)
+	{
+	  CHECK_PRINT_ERROR (text_print (obj_out, ",", 1, NULL));
+	}
+      CHECK_PRINT_ERROR (text_print_csv_field
+			 (obj_out, attribute->header.name, (int) strlen (attribute->header.name)));
+      ++v;
+    }
+  CHECK_PRINT_ERROR (text_print (obj_out, "\r\n", 2, NULL));
+
+exit_on_end:
+
+  return error;
+
+exit_on_error:
+
+  CHECK_EXIT_ERROR (error);
+  goto exit_on_end;
+}
+
 /*
  * process_object - dump one object in loader format
  *    return: NO_ERROR, if successful, error number, if not successful.
@@ -1480,11 +1561,12 @@ process_object (DESC_OBJ * desc_obj, OID * obj_oid, int referenced_class)
 	continue;
 
       if (v)
-	CHECK_PRINT_ERROR (text_print (obj_out, " ", 1, NULL));
+	CHECK_PRINT_ERROR (text_print (obj_out, csv_format ? "," : " ", 1, NULL));
 
       value = &desc_obj->values[attribute->storage_order];
 
-      if ((error = process_value (value)) != NO_ERROR)
+      error = csv_format ? process_csv_value (value) : process_value (value);
+      if (error != NO_ERROR)
 	{
 	  if (!ignore_err_flag)
 	    goto exit_on_error;
@@ -1492,7 +1574,14 @@ process_object (DESC_OBJ * desc_obj, OID * obj_oid, int referenced_class)
 
       ++v;
     }
-  CHECK_PRINT_ERROR (text_print (obj_out, "\n", 1, NULL));
+  if (csv_format)
+    {
+      CHECK_PRINT_ERROR (text_print (obj_out, "\r\n", 2, NULL));
+    }
+  else
+    {
+      CHECK_PRINT_ERROR (text_print (obj_out, "\n", 1, NULL));
+    }
 
 exit_on_end:
 
@@ -1775,6 +1864,172 @@ exit_on_error:
 
 }
 
+/*
+ * process_csv_value - dump a value as a CSV field
+ *    return: NO_ERROR, if successful, error number, if not successful.
+ *    value(in): value
+ * Note:
+ *    NULL is written as an empty field. Object references are written as
+ *    NULL, like for --datafile-per-class. Bit strings are written as
+ *    hexadecimal digits. Collections and LOBs have no CSV form and are
+ *    reported as errors.
+ */
+static int
+process_csv_value (DB_VALUE * value)
+{
+  int error = NO_ERROR;
+  static const char hex_digits[] = "0123456789abcdef";
+  char buf[CSV_VALUE_BUFFER_SIZE];
+  const char *str_ptr;
+  char *json_body;
+  int len, nhex, i, n;
+  unsigned char c;
+  DB_DATETIMETZ *dt_tz;
+  DB_TIMESTAMPTZ *ts_tz;
+
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_NULL:
+    case DB_TYPE_OID:
+    case DB_TYPE_OBJECT:
+      break;
+
+    case DB_TYPE_SMALLINT:
+      CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, "%d", (int) db_get_short (value)));
+      break;
+
+    case DB_TYPE_INTEGER:
+      CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, "%d", db_get_int (value)));
+      break;
+
+    case DB_TYPE_BIGINT:
+      CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, "%lld", (long long) db_get_bigint (value)));
+      break;
+
+    case DB_TYPE_FLOAT:
+      CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, "%.*g", 10, db_get_float (value)));
+      break;
+
+    case DB_TYPE_DOUBLE:
+      CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, "%.*g", 17, db_get_double (value)));
+      break;
+
+    case DB_TYPE_NUMERIC:
+      CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, "%s", numeric_db_value_print (value, buf)));
+      break;
+
+    case DB_TYPE_MONETARY:
+      CHECK_PRINT_ERROR (text_print (obj_out, NULL, 0, "%.*f", 2, db_get_monetary (value)->amount));
+      break;
+
+    case DB_TYPE_DATE:
+      db_date_to_string (buf, sizeof (buf), db_get_date (value));
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_TIME:
+      db_time_to_string (buf, sizeof (buf), db_get_time (value));
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_TIMESTAMP:
+      db_timestamp_to_string (buf, sizeof (buf), db_get_timestamp (value));
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_TIMESTAMPLTZ:
+      db_timestampltz_to_string (buf, sizeof (buf), db_get_timestamp (value));
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_TIMESTAMPTZ:
+      ts_tz = db_get_timestamptz (value);
+      db_timestamptz_to_string (buf, sizeof (buf), &ts_tz->timestamp, &ts_tz->tz_id);
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_DATETIME:
+      db_datetime_to_string (buf, sizeof (buf), db_get_datetime (value));
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_DATETIMELTZ:
+      db_datetimeltz_to_string (buf, sizeof (buf), db_get_datetime (value));
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_DATETIMETZ:
+      dt_tz = db_get_datetimetz (value);
+      db_datetimetz_to_string (buf, sizeof (buf), &dt_tz->datetime, &dt_tz->tz_id);
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, buf, (int) strlen (buf)));
+      break;
+
+    case DB_TYPE_ENUMERATION:
+      str_ptr = db_get_enum_string (value);
+      len = db_get_enum_string_size (value);
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, str_ptr != NULL ? str_ptr : "", str_ptr != NULL ? len : 0));
+      break;
+
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+      str_ptr = db_get_string (value);
+      len = db_get_string_size (value);
+      if (len < 0)
+	{
+	  len = (int) strlen (str_ptr);
+	}
+      CHECK_PRINT_ERROR (text_print_csv_field (obj_out, str_ptr, len));
+      break;
+
+    case DB_TYPE_BIT:
+    case DB_TYPE_VARBIT:
+      /* the hexadecimal digits of the X'...' form of the object file; they never need quoting */
+      str_ptr = db_get_bit (value, &len);
+      nhex = (len + 3) / 4;
+      if (nhex == 0)
+	{
+	  CHECK_PRINT_ERROR (text_print_csv_field (obj_out, "", 0));
+	  break;
+	}
+      for (i = 0, n = 0; i < nhex; i++)
+	{
+	  c = (unsigned char) str_ptr[i / 2];
+	  buf[n++] = hex_digits[(i % 2 == 0) ? (c >> 4) : (c & 0x0f)];
+	  if (n == CSV_VALUE_BUFFER_SIZE || i == nhex - 1)
+	    {
+	      CHECK_PRINT_ERROR (text_print (obj_out, buf, n, NULL));
+	      n = 0;
+	    }
+	}
+      break;
+
+    case DB_TYPE_JSON:
+      json_body = db_get_json_raw_body (value);
+      error = text_print_csv_field (obj_out, json_body, (int) strlen (json_body));
+      db_private_free (NULL, json_body);
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      break;
+
+    default:
+      error = ER_QPROC_INVALID_DATATYPE;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+      goto exit_on_error;
+    }
+
+exit_on_end:
+
+  return error;
+
+exit_on_error:
+
+  CHECK_EXIT_ERROR (error);
+  goto exit_on_end;
+}
 
 /*
  * update_hash - update obj_table hash
@@ -60,6 +60,7 @@ bool include_references = false;
 
 bool required_class_only = false;
 bool datafile_per_class = false;
+bool csv_format = false;
 bool split_schema_files = false;
 bool is_as_dba = false;
 LIST_MOPS *class_table = NULL;
@@ -116,6 +117,7 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   include_references = utility_get_option_bool_value (arg_map, UNLOAD_INCLUDE_REFERENCE_S);
   required_class_only = utility_get_option_bool_value (arg_map, UNLOAD_INPUT_CLASS_ONLY_S);
   datafile_per_class = utility_get_option_bool_value (arg_map, UNLOAD_DATAFILE_PER_CLASS_S);
+  csv_format = utility_get_option_bool_value (arg_map, UNLOAD_CSV_S);
   lo_count = utility_get_option_int_value (arg_map, UNLOAD_LO_COUNT_S);
   est_size = utility_get_option_int_value (arg_map, UNLOAD_ESTIMATED_SIZE_S);
   cached_pages = utility_get_option_int_value (arg_map, UNLOAD_CACHED_PAGES_S);
@@ -158,6 +160,12 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
       output_prefix = database_name;
     }
 
+  if (csv_format)
+    {
+      /* a CSV file holds the rows of a single class and no object references */
+      datafile_per_class = true;
+    }
+
   if (output_dirname != NULL)
     {
       unload_context.output_dirname = output_dirname;
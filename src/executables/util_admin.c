@@ -535,6 +535,7 @@ static UTIL_ARG_MAP ua_Unload_Option_Map[] = {
   {UNLOAD_SPLIT_SCHEMA_FILES_S, {ARG_BOOLEAN}, {0}},
   {UNLOAD_AS_DBA_S, {ARG_BOOLEAN}, {0}},
   {UNLOAD_SKIP_INDEX_DETAIL_S, {ARG_BOOLEAN}, {0}},	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
+  {UNLOAD_CSV_S, {ARG_BOOLEAN}, {0}},
   {0, {0}, {0}}
 };
 
@@ -562,6 +563,7 @@ static GETOPT_LONG ua_Unload_Option[] = {
   {UNLOAD_SPLIT_SCHEMA_FILES_L, 0, 0, UNLOAD_SPLIT_SCHEMA_FILES_S},
   {UNLOAD_AS_DBA_L, 0, 0, UNLOAD_AS_DBA_S},
   {UNLOAD_SKIP_INDEX_DETAIL_L, 0, 0, UNLOAD_SKIP_INDEX_DETAIL_S},	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
+  {UNLOAD_CSV_L, 0, 0, UNLOAD_CSV_S},
   {0, 0, 0, 0}
 };
 
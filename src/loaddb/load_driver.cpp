@@ -22,11 +22,32 @@
 
 #include "load_driver.hpp"
 
+#include "load_fast_scanner.hpp"
+
 #include <cassert>
+#include <streambuf>
 
 namespace cubload
 {
 
+  /*
+   * cubload::memory_input_buffer
+   *
+   * description
+   *    Read-only stream buffer over memory owned by the caller. The scanner reads the memory in place, instead of
+   *    through the copy std::istringstream makes of its string.
+   */
+  class memory_input_buffer : public std::streambuf
+  {
+    public:
+      memory_input_buffer (const char *buffer, std::size_t size)
+      {
+	// the get area is only read from
+	char *begin = const_cast<char *> (buffer);
+	setg (begin, begin, begin + size);
+      }
+  };
+
   driver::driver ()
     : m_scanner (NULL)
     , m_class_installer (NULL)
@@ -92,6 +113,55 @@ namespace cubload
     return parser.parse ();
   }
 
+  int
+  driver::parse (const char *buffer, std::size_t size, int line_offset)
+  {
+    fast_scanner scanner (m_semantic_helper);
+    const char *buffer_end = buffer + size;
+    const char *line = buffer;
+    const char *next_line = NULL;
+    constant_type *constants = NULL;
+    int lineno = line_offset + 1;
+
+    assert (m_class_installer != NULL && m_object_loader != NULL);
+
+    m_semantic_helper.reset_after_batch ();
+
+    // Leading lines made only of common constants skip the flex scanner and bison grammar. They are handed to the
+    // object loader the same way the instance_line rule does.
+    while (line < buffer_end && scanner.scan_line (line, buffer_end, constants, next_line))
+      {
+	if (constants != NULL)
+	  {
+	    m_start_line_no = lineno;
+	    // the grammar processes a line after it has read its newline
+	    m_scanner->set_lineno (lineno + 1);
+
+	    m_object_loader->start_line (-1);
+	    m_object_loader->process_line (constants);
+	    m_object_loader->finish_line ();
+	    m_semantic_helper.reset_after_line ();
+	  }
+
+	line = next_line;
+	lineno++;
+      }
+
+    if (line == buffer_end && size > 0)
+      {
+	// the whole batch was loaded; end it like loader_start does
+	m_object_loader->flush_records ();
+	m_object_loader->destroy ();
+	return 0;
+      }
+
+    // the grammar parses the rest of the batch, starting with the first line the fast scanner refused
+    memory_input_buffer input_buffer (line, buffer_end - line);
+    std::istream iss (&input_buffer);
+
+    return parse (iss, lineno - 1);
+  }
+
   class_installer &
   driver::get_class_installer ()
   {
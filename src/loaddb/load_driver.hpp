@@ -82,6 +82,8 @@ namespace cubload
 
       // Parse functions
       int parse (std::istream &iss, int line_offset = 0);
+      // parse a batch held in memory; its common instance lines are scanned without the grammar
+      int parse (const char *buffer, std::size_t size, int line_offset = 0);
 
       class_installer &get_class_installer ();
       object_loader &get_object_loader ();
@@ -0,0 +1,400 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * load_fast_scanner.cpp - hand-written scanner for the common instance lines of the object file
+ */
+
+#include "load_fast_scanner.hpp"
+
+#include "error_manager.h"
+
+namespace cubload
+{
+
+  struct fast_scanner_keyword
+  {
+    const char *name;		// lower case
+    data_type type;
+  };
+
+  // keywords followed by a quoted string; see sql2_date and the like in load_grammar.yy
+  static const fast_scanner_keyword FAST_SCANNER_QUOTED_KEYWORDS[] =
+  {
+    { "date", LDR_DATE },
+    { "time", LDR_TIME },
+    { "utime", LDR_TIMESTAMP },
+    { "timestamp", LDR_TIMESTAMP },
+    { "timestampltz", LDR_TIMESTAMPLTZ },
+    { "timestamptz", LDR_TIMESTAMPTZ },
+    { "datetime", LDR_DATETIME },
+    { "datetimeltz", LDR_DATETIMELTZ },
+    { "datetimetz", LDR_DATETIMETZ }
+  };
+
+  static bool
+  is_delimiter (char c)
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  }
+
+  static bool
+  is_digit (char c)
+  {
+    return c >= '0' && c <= '9';
+  }
+
+  static bool
+  is_letter (char c)
+  {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  }
+
+  // true if c continues an identifier of the flex scanner after its letters
+  static bool
+  is_identifier_char (char c)
+  {
+    return is_digit (c) || c == '_' || c == '%' || c == '#' || (unsigned char) c >= 0x80;
+  }
+
+  static bool
+  is_keyword (const char *text, std::size_t length, const char *keyword)
+  {
+    std::size_t i;
+
+    // text is made of ascii letters only
+    for (i = 0; i < length && keyword[i] != '\0'; i++)
+      {
+	if ((text[i] | 0x20) != keyword[i])
+	  {
+	    return false;
+	  }
+      }
+
+    return i == length && keyword[i] == '\0';
+  }
+
+  fast_scanner::fast_scanner (semantic_helper &semantic_helper)
+    : m_semantic_helper (semantic_helper)
+  {
+    //
+  }
+
+  /*
+   * scan_line () - scan one instance line
+   *   return: true if the line was scanned, false if it must be parsed by the grammar
+   *   line(in): start of the line
+   *   buffer_end(in): end of the buffer holding the line
+   *   constants(out): constants of the line, NULL for a blank line
+   *   next_line(out): start of the next line
+   *
+   *   Note: a line that is refused leaves nothing behind in the semantic helper pools.
+   */
+  bool
+  fast_scanner::scan_line (const char *line, const char *buffer_end, constant_type *&constants, const char *&next_line)
+  {
+    const char *pos = line;
+    constant_type *con;
+
+    constants = NULL;
+
+    while (true)
+      {
+	while (pos < buffer_end && (*pos == ' ' || *pos == '\t'))
+	  {
+	    pos++;
+	  }
+
+	if (pos == buffer_end)
+	  {
+	    // the grammar requires each line to end with a newline
+	    break;
+	  }
+
+	if (*pos == '\n')
+	  {
+	    next_line = pos + 1;
+	    return true;
+	  }
+	if (*pos == '\r' && pos + 1 < buffer_end && pos[1] == '\n')
+	  {
+	    next_line = pos + 2;
+	    return true;
+	  }
+
+	con = scan_constant (pos, buffer_end);
+	if (con == NULL)
+	  {
+	    break;
+	  }
+	constants = m_semantic_helper.append_constant_list (constants, con);
+      }
+
+    m_semantic_helper.reset_after_line ();
+    constants = NULL;
+
+    return false;
+  }
+
+  constant_type *
+  fast_scanner::scan_constant (const char *&pos, const char *end)
+  {
+    string_type *str;
+
+    if (*pos == '\'')
+      {
+	str = scan_quoted_string (pos, end);
+	return str != NULL ? m_semantic_helper.make_constant (LDR_STR, str) : NULL;
+      }
+    else if (is_digit (*pos) || *pos == '+' || *pos == '-' || *pos == '.')
+      {
+	return scan_number (pos, end);
+      }
+    else if (is_letter (*pos))
+      {
+	return scan_keyword (pos, end);
+      }
+
+    return NULL;
+  }
+
+  /*
+   * scan_number () - scan an integer or a real, see INT_LIT and REAL_LIT in load_lexer.l
+   */
+  constant_type *
+  fast_scanner::scan_number (const char *&pos, const char *end)
+  {
+    const char *p = pos;
+    const char *digits;
+    std::size_t int_digits;
+    bool is_real = false;
+    string_type *str;
+
+    if (*p == '+' || *p == '-')
+      {
+	p++;
+      }
+
+    digits = p;
+    while (p < end && is_digit (*p))
+      {
+	p++;
+      }
+    int_digits = p - digits;
+
+    if (p < end && *p == '.')
+      {
+	digits = ++p;
+	while (p < end && is_digit (*p))
+	  {
+	    p++;
+	  }
+	if (int_digits == 0 && p == digits)
+	  {
+	    return NULL;
+	  }
+	is_real = true;
+      }
+    else if (int_digits == 0)
+      {
+	return NULL;
+      }
+
+    if (p < end && (*p == 'e' || *p == 'E'))
+      {
+	const char *exp = p + 1;
+
+	if (exp < end && (*exp == '+' || *exp == '-'))
+	  {
+	    exp++;
+	  }
+	digits = exp;
+	while (exp < end && is_digit (*exp))
+	  {
+	    exp++;
+	  }
+	if (exp == digits)
+	  {
+	    return NULL;
+	  }
+	p = exp;
+	is_real = true;
+      }
+
+    if (is_real && p < end && (*p == 'f' || *p == 'F' || *p == 'l' || *p == 'L'))
+      {
+	p++;
+      }
+
+    if (p < end && !is_delimiter (*p))
+      {
+	// e.g. an object id, a time or a date literal
+	return NULL;
+      }
+
+    str = m_semantic_helper.make_string_by_yytext (pos, (int) (p - pos));
+    if (str == NULL)
+      {
+	er_clear ();
+	return NULL;
+      }
+    pos = p;
+
+    return is_real ? m_semantic_helper.make_real (str) : m_semantic_helper.make_constant (LDR_INT, str);
+  }
+
+  /*
+   * scan_keyword () - scan NULL, a national string or a quoted date and time constant
+   */
+  constant_type *
+  fast_scanner::scan_keyword (const char *&pos, const char *end)
+  {
+    const char *p = pos;
+    std::size_t length;
+    string_type *str;
+
+    while (p < end && is_letter (*p))
+      {
+	p++;
+      }
+    if (p < end && is_identifier_char (*p))
+      {
+	return NULL;
+      }
+    length = p - pos;
+
+    if (length == 1 && (*pos | 0x20) == 'n' && p < end && *p == '\'')
+      {
+	str = scan_quoted_string (p, end);
+	if (str == NULL)
+	  {
+	    return NULL;
+	  }
+	pos = p;
+	return m_semantic_helper.make_constant (LDR_NSTR, str);
+      }
+
+    if (is_keyword (pos, length, "null"))
+      {
+	if (p < end && !is_delimiter (*p))
+	  {
+	    return NULL;
+	  }
+	pos = p;
+	return m_semantic_helper.make_constant (LDR_NULL, NULL);
+      }
+
+    for (const fast_scanner_keyword &keyword : FAST_SCANNER_QUOTED_KEYWORDS)
+      {
+	if (!is_keyword (pos, length, keyword.name))
+	  {
+	    continue;
+	  }
+
+	while (p < end && (*p == ' ' || *p == '\t'))
+	  {
+	    p++;
+	  }
+	if (p == end || *p != '\'')
+	  {
+	    return NULL;
+	  }
+
+	str = scan_quoted_string (p, end);
+	if (str == NULL)
+	  {
+	    return NULL;
+	  }
+	pos = p;
+	return m_semantic_helper.make_constant (keyword.type, str);
+      }
+
+    return NULL;
+  }
+
+  /*
+   * scan_quoted_string () - scan a single quoted string, see the SQS start condition in load_lexer.l
+   *   return: the string, or NULL if it must be scanned by the flex scanner
+   *   pos(in/out): opening quote; after the closing quote on success
+   *   end(in): end of the buffer
+   */
+  string_type *
+  fast_scanner::scan_quoted_string (const char *&pos, const char *end)
+  {
+    const char *body = pos + 1;
+    const char *p;
+    bool has_escaped_quote = false;
+    string_type *str;
+
+    for (p = body; ; p++)
+      {
+	if (p == end || *p == '\n')
+	  {
+	    // unterminated, or a string over several lines
+	    return NULL;
+	  }
+	if (*p == '\'')
+	  {
+	    if (p + 1 < end && p[1] == '\'')
+	      {
+		has_escaped_quote = true;
+		p++;
+		continue;
+	      }
+	    break;
+	  }
+      }
+
+    if (p + 1 < end && !is_delimiter (p[1]))
+      {
+	// e.g. a string continued on the next line with '+
+	return NULL;
+      }
+
+    if (!has_escaped_quote)
+      {
+	str = m_semantic_helper.make_string_by_yytext (body, (int) (p - body));
+      }
+    else
+      {
+	m_semantic_helper.set_quoted_string_buffer ();
+	for (const char *c = body; c < p; c++)
+	  {
+	    m_semantic_helper.append_char (*c);
+	    if (*c == '\'')
+	      {
+		// skip the second quote of the pair
+		c++;
+	      }
+	  }
+	m_semantic_helper.append_char ('\0');
+	str = m_semantic_helper.make_string_by_buffer ();
+      }
+
+    if (str == NULL)
+      {
+	// invalid characters; the flex scanner reports them
+	er_clear ();
+	return NULL;
+      }
+    pos = p + 1;
+
+    return str;
+  }
+
+} // namespace cubload
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * load_fast_scanner.hpp - hand-written scanner for the common instance lines of the object file
+ */
+
+#ifndef _LOAD_FAST_SCANNER_HPP_
+#define _LOAD_FAST_SCANNER_HPP_
+
+#include "load_common.hpp"
+#include "load_semantic_helper.hpp"
+
+#include <cstddef>
+
+namespace cubload
+{
+
+  /*
+   * cubload::fast_scanner
+   *
+   * description
+   *    Scans the instance lines that are only made of the most common constants: integers, reals, single quoted and
+   *    national strings, NULL and the quoted date and time constants. The line is read in place and its constants
+   *    are built through semantic_helper, with the same types and values the flex scanner and bison grammar would
+   *    give them.
+   *
+   *    Any other line is refused as a whole, before any of it is handed to the object loader: commands, object ids
+   *    and references, collections, monetary and bit string constants, double quoted strings, comments, continued
+   *    lines, strings spanning several lines and every syntax error. The caller then parses it with the grammar.
+   *
+   * how to use
+   *    cubload::fast_scanner scanner (semantic_helper);
+   *    constant_type *constants;
+   *    const char *next_line;
+   *
+   *    if (scanner.scan_line (line, buffer_end, constants, next_line))
+   *      {
+   *        // constants is the list of constants of the line, NULL for a blank line; next_line follows its newline
+   *      }
+   *    else
+   *      {
+   *        // the line must be parsed by the grammar
+   *      }
+   */
+  class fast_scanner
+  {
+    public:
+      explicit fast_scanner (semantic_helper &semantic_helper);
+
+      // Copy constructor (disabled).
+      fast_scanner (const fast_scanner &copy) = delete;
+
+      // Copy assignment operator (disabled)
+      fast_scanner &operator= (const fast_scanner &other) = delete;
+
+      ~fast_scanner () = default;
+
+      bool scan_line (const char *line, const char *buffer_end, constant_type *&constants, const char *&next_line);
+
+    private:
+      semantic_helper &m_semantic_helper;
+
+      constant_type *scan_constant (const char *&pos, const char *end);
+      constant_type *scan_number (const char *&pos, const char *end);
+      constant_type *scan_keyword (const char *&pos, const char *end);
+      string_type *scan_quoted_string (const char *&pos, const char *end);
+  };
+
+} // namespace cubload
+
+#endif /* _LOAD_FAST_SCANNER_HPP_ */
@@ -514,6 +514,64 @@ exit_on_error:
   goto exit_on_end;
 }
 
+/*
+ * text_print_csv_field - print a string as a CSV field to TEXT_OUTPUT
+ *    return: NO_ERROR if successful, error code otherwise
+ *    tout(out): TEXT_OUTPUT
+ *    str(in): string
+ *    len(in): string size in bytes
+ * Note:
+ *    As RFC 4180 requires, a field holding a comma, a double quote or a line
+ *    break is enclosed in double quotes and its double quotes are doubled.
+ *    An empty string is quoted so that it reads back differently from NULL.
+ */
+int
+text_print_csv_field (TEXT_OUTPUT * tout, const char *str, int len)
+{
+  int error = NO_ERROR;
+  const char *end = str + len;
+  const char *p;
+
+  for (p = str; p < end; p++)
+    {
+      if (*p == ',' || *p == '"' || *p == '\r' || *p == '\n')
+	{
+	  break;
+	}
+    }
+  if (len > 0 && p == end)
+    {
+      CHECK_PRINT_ERROR (text_print (tout, str, len, NULL));
+      goto exit_on_end;
+    }
+
+  CHECK_PRINT_ERROR (text_print (tout, "\"", 1, NULL));
+  while (str < end)
+    {
+      p = (const char *) memchr (str, '"', end - str);
+      if (p == NULL)
+	{
+	  CHECK_PRINT_ERROR (text_print (tout, str, (int) (end - str), NULL));
+	  break;
+	}
+
+      /* write up to and including the quote, then the quote again */
+      CHECK_PRINT_ERROR (text_print (tout, str, (int) (p - str + 1), NULL));
+      CHECK_PRINT_ERROR (text_print (tout, "\"", 1, NULL));
+      str = p + 1;
+    }
+  CHECK_PRINT_ERROR (text_print (tout, "\"", 1, NULL));
+
+exit_on_end:
+
+  return error;
+
+exit_on_error:
+
+  CHECK_EXIT_ERROR (error);
+  goto exit_on_end;
+}
+
 /*
  * desc_obj_to_disk - transforms the object into a disk record for eventual
  * storage.
@@ -521,6 +521,7 @@ namespace cubload
     , m_recdes_collected ()
     , m_scancache_started (false)
     , m_scancache ()
+    , m_has_index (true)
     , m_rows (0)
   {
     //
@@ -710,7 +711,7 @@ namespace cubload
 	    log_sysop_start (m_thread_ref);
 	    RECDES local_record = m_recdes_collected[i].get_recdes ();
 	    int error_code = locator_insert_force (m_thread_ref, &m_scancache.node.hfid, &m_scancache.node.class_oid,
-						   &dummy_oid, &local_record, true, op_type, &m_scancache, &force_count,
+						   &dummy_oid, &local_record, m_has_index, op_type, &m_scancache, &force_count,
 						   pruning_type, NULL, NULL, UPDATE_INPLACE_NONE, NULL, has_BU_lock,
 						   true, false);
 	    if (error_code != NO_ERROR)
@@ -738,7 +739,7 @@ namespace cubload
       {
 	log_sysop_start (m_thread_ref);
 	int error_code = locator_multi_insert_force (m_thread_ref, &m_scancache.node.hfid, &m_scancache.node.class_oid,
-			 m_recdes_collected, true, op_type, &m_scancache, &force_count, pruning_type, NULL, NULL,
+			 m_recdes_collected, m_has_index, op_type, &m_scancache, &force_count, pruning_type, NULL, NULL,
 			 UPDATE_INPLACE_NONE, true);
 	if (error_code != NO_ERROR)
 	  {
@@ -1015,6 +1016,8 @@ namespace cubload
   server_object_loader::start_scancache (const OID &class_oid)
   {
     hfid hfid;
+    OR_CLASSREP *classrepr;
+    int classrepr_cacheindex = -1;
 
     int error_code = heap_get_class_info (m_thread_ref, &class_oid, &hfid, NULL, NULL);
     if (error_code != NO_ERROR)
@@ -1023,6 +1026,18 @@ namespace cubload
 	return;
       }
 
+    // Classes loaded before their index file (as unloaddb output is) have no index yet. Their rows can skip the per-row
+    // index maintenance of locator_insert_force, which would otherwise fetch the class representation for every row
+    // only to find nothing to do; the indexes are then built by the bulk loader of CREATE INDEX.
+    classrepr = heap_classrepr_get (m_thread_ref, &class_oid, NULL, NULL_REPRID, &classrepr_cacheindex);
+    if (classrepr == NULL)
+      {
+	m_error_handler.on_failure_with_line (LOADDB_MSG_LOAD_FAIL);
+	return;
+      }
+    m_has_index = (classrepr->n_indexes > 0);
+    heap_classrepr_free_and_init (classrepr, &classrepr_cacheindex);
+
     error_code = heap_scancache_start_modify (m_thread_ref, &m_scancache, &hfid, &class_oid, MULTI_ROW_INSERT, NULL);
     if (error_code != NO_ERROR)
       {
@@ -1065,6 +1080,7 @@ namespace cubload
 
     heap_scancache_end_modify (m_thread_ref, &m_scancache);
     m_scancache_started = false;
+    m_has_index = true;
   }
 
   void
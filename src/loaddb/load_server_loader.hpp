@@ -115,6 +115,7 @@ namespace cubload
 
       bool m_scancache_started;
       heap_scancache m_scancache;
+      bool m_has_index;
 
       std::size_t m_rows;
   };
@@ -28,8 +28,6 @@
 #include "resource_shared_pool.hpp"
 #include "xserver_interface.h"
 
-#include <sstream>
-
 namespace cubload
 {
 
@@ -77,8 +75,9 @@ namespace cubload
     driver->get_class_installer ().set_class_id (batch_.get_class_id ());
 
     // parse doc says that 0 is returned if parsing succeeds
-    std::istringstream iss (batch_.get_content ());
-    int parser_result = driver->parse (iss, batch_.get_line_offset ());
+    // parse the batch in place, without copying its content into a stream
+    const std::string &content = batch_.get_content ();
+    int parser_result = driver->parse (content.data (), content.size (), batch_.get_line_offset ());
 
     driver->get_object_loader ().destroy ();
 
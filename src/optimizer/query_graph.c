@@ -106,6 +106,10 @@
 #define NOMINAL_HEAP_SIZE(class)	200	/* pages */
 #define NOMINAL_OBJECT_SIZE(class)	 64	/* bytes */
 
+/* Relative cost of descending the B+tree once per distinct prefix, compared to reading one leaf page, used to decide
+ * on a loose index scan that was not requested with a hint. */
+#define QO_ILS_DESCENT_COST_FACTOR	2
+
 /* Figure out how many bytes a QO_NODE_INDEX struct with n entries requires. */
 #define SIZEOF_NODE_INDEX(n) \
     (sizeof(QO_NODE_INDEX) + (((n)-1)* sizeof(QO_NODE_INDEX_ENTRY)))
@@ -253,6 +257,7 @@ static QO_SEGMENT *qo_eqclass_wrt (QO_EQCLASS *, BITSET *);
 static void qo_env_dump (QO_ENV *, FILE *);
 static int qo_get_ils_prefix_length (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_entry);
 static bool qo_is_iss_index (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_entry);
+static void qo_check_ils_statistics (QO_ENV * env, QO_NODE * nodep);
 static void qo_discover_sort_limit_join_nodes (QO_ENV * env, QO_NODE * nodep, BITSET * order_nodes, BITSET * dep_nodes);
 static bool qo_is_pk_fk_full_join (QO_ENV * env, QO_NODE * fk_node, QO_NODE * pk_node);
 static bool qo_is_non_mvcc_class_with_index (QO_CLASS_INFO_ENTRY * class_entry_p);
@@ -6991,15 +6996,11 @@ qo_get_ils_prefix_length (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_
       return 0;			/* not applicable */
     }
 
-  /* check hint */
+  /* check hint; without the INDEX_LS hint, the prefix is validated later by qo_check_ils_statistics () */
   if (tree->info.query.q.select.hint & PT_HINT_NO_INDEX_LS)
     {
       return 0;			/* disable loose index scan */
     }
-  else if (!(tree->info.query.q.select.hint & PT_HINT_INDEX_LS) || !(QO_NODE_HINT (nodep) & PT_HINT_INDEX_LS))
-    {
-      return 0;			/* disable loose index scan */
-    }
 
   if (PT_SELECT_INFO_IS_FLAGED (tree, PT_SELECT_INFO_DISABLE_LOOSE_SCAN))
     {
@@ -7051,6 +7052,65 @@ qo_get_ils_prefix_length (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_
   return prefix_len;
 }
 
+/*
+ * qo_check_ils_statistics () - keep loose index scan candidates that were not forced by a hint only if statistics
+ *				show them cheaper than a full index scan
+ *   return: nothing
+ *   env(in): environment
+ *   nodep(in): graph node, with index statistics already collected
+ *
+ * Note: A loose index scan descends the B+tree once for each distinct prefix value, while a full scan reads every
+ *	 leaf page. Candidates rejected here fall back to the index skip scan check.
+ */
+static void
+qo_check_ils_statistics (QO_ENV * env, QO_NODE * nodep)
+{
+  QO_NODE_INDEX *node_indexp;
+  QO_NODE_INDEX_ENTRY *ni_entryp;
+  QO_INDEX_ENTRY *index_entryp;
+  QO_ATTR_CUM_STATS *cum_statsp;
+  PT_NODE *tree;
+  int i, prefix_len;
+
+  tree = env->pt_tree;
+  node_indexp = QO_NODE_INDEXES (nodep);
+  if (tree == NULL || tree->node_type != PT_SELECT || node_indexp == NULL)
+    {
+      return;
+    }
+
+  if ((tree->info.query.q.select.hint & PT_HINT_INDEX_LS) && (QO_NODE_HINT (nodep) & PT_HINT_INDEX_LS))
+    {
+      /* forced by hint */
+      return;
+    }
+
+  for (i = 0, ni_entryp = QO_NI_ENTRY (node_indexp, 0); i < QO_NI_N (node_indexp); i++, ni_entryp++)
+    {
+      if (ni_entryp->head == NULL || ni_entryp->head->ils_prefix_len <= 0)
+	{
+	  continue;
+	}
+
+      cum_statsp = &ni_entryp->cum_stats;
+      prefix_len = ni_entryp->head->ils_prefix_len;
+
+      if (cum_statsp->pkeys != NULL && prefix_len <= cum_statsp->pkeys_size && cum_statsp->pkeys[prefix_len - 1] >= 1
+	  && ((double) cum_statsp->pkeys[prefix_len - 1] * MAX (cum_statsp->height, 1) * QO_ILS_DESCENT_COST_FACTOR
+	      < (double) cum_statsp->leafs))
+	{
+	  /* few distinct prefixes compared to the index size */
+	  continue;
+	}
+
+      for (index_entryp = ni_entryp->head; index_entryp != NULL; index_entryp = index_entryp->next)
+	{
+	  index_entryp->ils_prefix_len = 0;
+	  index_entryp->is_iss_candidate = qo_is_iss_index (env, nodep, index_entryp);
+	}
+    }
+}
+
 /*
  * qo_is_iss_index () - check if we can use the Index Skip Scan optimization
  *   return: bool
@@ -7651,6 +7711,7 @@ qo_discover_indexes (QO_ENV * env)
 		{
 		  /* collect statistics if discovers an usable index */
 		  qo_get_index_info (env, nodep);
+		  qo_check_ils_statistics (env, nodep);
 		  continue;
 		}
 	      /* fall through */
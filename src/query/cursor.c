@@ -413,34 +413,17 @@ cursor_get_tuple_value_to_dbvalue (OR_BUF * buffer_p, TP_DOMAIN * domain_p, QFIL
 }
 
 /*
- * cursor_get_tuple_value_from_list () - The tuple value at the indicated position is
- *   extracted and mapped to given db_value
- *   return: NO_ERROR on all ok, ER status( or ER_FAILED) otherwise
+ * cursor_locate_tuple_value () - Find the tuple value at the indicated position
+ *   return: pointer to the header of the index-th tuple value
  *   c_id(in)   : Cursor Identifier
  *   index(in)  : Tuple Value index
- *   value(out) : Set to the fetched tuple value
  *   tuple(in)  : List file tuple
  */
-static int
-cursor_get_tuple_value_from_list (CURSOR_ID * cursor_id_p, int index, DB_VALUE * value_p, char *tuple_p)
+static char *
+cursor_locate_tuple_value (CURSOR_ID * cursor_id_p, int index, char *tuple_p)
 {
-  QFILE_TUPLE_VALUE_TYPE_LIST *type_list_p;
-  QFILE_TUPLE_VALUE_FLAG flag;
-  OR_BUF buffer;
   int i;
 
-  if (cursor_id_p == NULL)
-    {
-      assert (0);
-      return ER_FAILED;
-    }
-
-  type_list_p = &cursor_id_p->list_id.type_list;
-
-  assert (index >= 0 && index < type_list_p->type_cnt);
-
-  or_init (&buffer, tuple_p, QFILE_GET_TUPLE_LENGTH (tuple_p));
-
   /* check for saved tplvalue position info */
   if (cursor_id_p->current_tuple_value_index >= 0 && cursor_id_p->current_tuple_value_index <= index
       && cursor_id_p->current_tuple_value_p != NULL)
@@ -463,11 +446,44 @@ cursor_get_tuple_value_from_list (CURSOR_ID * cursor_id_p, int index, DB_VALUE *
   cursor_id_p->current_tuple_value_index = i;
   cursor_id_p->current_tuple_value_p = tuple_p;
 
+  return tuple_p;
+}
+
+/*
+ * cursor_get_tuple_value_from_list () - The tuple value at the indicated position is
+ *   extracted and mapped to given db_value
+ *   return: NO_ERROR on all ok, ER status( or ER_FAILED) otherwise
+ *   c_id(in)   : Cursor Identifier
+ *   index(in)  : Tuple Value index
+ *   value(out) : Set to the fetched tuple value
+ *   tuple(in)  : List file tuple
+ */
+static int
+cursor_get_tuple_value_from_list (CURSOR_ID * cursor_id_p, int index, DB_VALUE * value_p, char *tuple_p)
+{
+  QFILE_TUPLE_VALUE_TYPE_LIST *type_list_p;
+  QFILE_TUPLE_VALUE_FLAG flag;
+  OR_BUF buffer;
+
+  if (cursor_id_p == NULL)
+    {
+      assert (0);
+      return ER_FAILED;
+    }
+
+  type_list_p = &cursor_id_p->list_id.type_list;
+
+  assert (index >= 0 && index < type_list_p->type_cnt);
+
+  or_init (&buffer, tuple_p, QFILE_GET_TUPLE_LENGTH (tuple_p));
+
+  tuple_p = cursor_locate_tuple_value (cursor_id_p, index, tuple_p);
+
   flag = QFILE_GET_TUPLE_VALUE_FLAG (tuple_p);
   tuple_p += QFILE_TUPLE_VALUE_HEADER_SIZE;
   buffer.ptr = tuple_p;
 
-  return cursor_get_tuple_value_to_dbvalue (&buffer, type_list_p->domp[i], flag, value_p,
+  return cursor_get_tuple_value_to_dbvalue (&buffer, type_list_p->domp[index], flag, value_p,
 					    cursor_id_p->is_copy_tuple_value);
 }
 
@@ -1762,6 +1778,61 @@ cursor_get_tuple_value (CURSOR_ID * cursor_id_p, int index, DB_VALUE * value_p)
   return cursor_get_tuple_value_from_list (cursor_id_p, index, value_p, tuple_p);
 }
 
+/*
+ * cursor_peek_tuple_value_bytes () - Peek the disk representation of the tuple value at the indicated position
+ *   return: NO_ERROR on all ok, ER status( or ER_FAILED) otherwise
+ *   cursor_id(in): Cursor Identifier
+ *   index(in): Tuple Value index
+ *   type(out): Type of the tuple value
+ *   bytes(out): Set to the value inside the cursor buffer, or NULL if the value is unbound
+ * Note: No conversion is done; the bytes are laid out as the type's
+ *       data_writeval left them and are only valid until the cursor moves.
+ */
+int
+cursor_peek_tuple_value_bytes (CURSOR_ID * cursor_id_p, int index, DB_TYPE * type_p, const char **bytes_p)
+{
+  char *tuple_p;
+  TP_DOMAIN *domain_p;
+
+  if (cursor_id_p == NULL)
+    {
+      assert (0);
+      return ER_FAILED;
+    }
+
+  if (cursor_id_p->is_oid_included == true)
+    {
+      index++;
+    }
+
+  if (index < 0 || index >= cursor_id_p->list_id.type_list.type_cnt)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_TPLVAL_INDEX, 1, index);
+      return ER_FAILED;
+    }
+
+  tuple_p = cursor_peek_tuple (cursor_id_p);
+  if (tuple_p == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  domain_p = cursor_id_p->list_id.type_list.domp[index];
+  *type_p = (domain_p->type != NULL) ? domain_p->type->id : DB_TYPE_UNKNOWN;
+
+  tuple_p = cursor_locate_tuple_value (cursor_id_p, index, tuple_p);
+  if (QFILE_GET_TUPLE_VALUE_FLAG (tuple_p) == V_UNBOUND)
+    {
+      *bytes_p = NULL;
+    }
+  else
+    {
+      *bytes_p = tuple_p + QFILE_TUPLE_VALUE_HEADER_SIZE;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * cursor_get_tuple_value_list () -
  *   return: NO_ERROR on all ok, ER status( or ER_FAILED) otherwise
@@ -129,5 +129,6 @@ extern int cursor_prev_tuple (CURSOR_ID * cursor_id);
 extern int cursor_first_tuple (CURSOR_ID * cursor_id);
 extern int cursor_last_tuple (CURSOR_ID * cursor_id);
 extern int cursor_get_tuple_value (CURSOR_ID * result, int index, DB_VALUE * value);
+extern int cursor_peek_tuple_value_bytes (CURSOR_ID * cursor_id, int index, DB_TYPE * type, const char **bytes);
 
 #endif /* _CURSOR_H_ */
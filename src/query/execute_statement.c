@@ -14771,7 +14771,11 @@ do_execute_session_statement (PARSER_CONTEXT * parser, PT_NODE * statement)
   CACHE_TIME_RESET (&clt_cache_time);
   if (statement->flag.clt_cache_check)
     {
-      clt_cache_time = statement->cache_time;
+      /* a reusable client cache comes back without a list file, so INTO has nothing to read from */
+      if (statement->info.execute.into_list == NULL)
+	{
+	  clt_cache_time = statement->cache_time;
+	}
       statement->flag.clt_cache_check = 0;
     }
   CACHE_TIME_RESET (&statement->cache_time);
@@ -14976,7 +14980,11 @@ do_execute_select (PARSER_CONTEXT * parser, PT_NODE * statement)
   CACHE_TIME_RESET (&clt_cache_time);
   if (statement->flag.clt_cache_check)
     {
-      clt_cache_time = statement->cache_time;
+      /* a reusable client cache comes back without a list file, so INTO has nothing to read from */
+      if (statement->info.query.into_list == NULL)
+	{
+	  clt_cache_time = statement->cache_time;
+	}
       statement->flag.clt_cache_check = 0;
     }
   CACHE_TIME_RESET (&statement->cache_time);
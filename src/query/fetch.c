@@ -4597,6 +4597,42 @@ fetch_val_list (THREAD_ENTRY * thread_p, regu_variable_list_node * regu_list, va
   return NO_ERROR;
 }
 
+/*
+ * fetch_is_peekable_without_tuple () - check if fetch_peek_dbval can read a regu variable without a tuple
+ *   return: true if the regu variable is a plain reference to an already available value
+ *   regu_var(in): Regulator Variable
+ *
+ * Note: Used by the top-n sort to compare the sort keys of a row before its
+ *       output tuple is built. List file columns (TYPE_POSITION) are read
+ *       from the tuple and are not peekable. Expressions are not peekable
+ *       either: evaluating them twice would cost more than building the
+ *       tuple and some of them have side effects (e.g. serials).
+ */
+bool
+fetch_is_peekable_without_tuple (const regu_variable_node * regu_var)
+{
+  if (REGU_VARIABLE_IS_FLAGED (regu_var, REGU_VARIABLE_UPD_INS_LIST))
+    {
+      return false;
+    }
+
+  switch (regu_var->type)
+    {
+    case TYPE_ATTR_ID:
+    case TYPE_CLASS_ATTR_ID:
+    case TYPE_SHARED_ATTR_ID:
+    case TYPE_DBVAL:
+      return true;
+
+    case TYPE_CONSTANT:
+      /* values of subqueries are fetched when the tuple is built */
+      return regu_var->xasl == NULL;
+
+    default:
+      return false;
+    }
+}
+
 /*
  * fetch_init_val_list () -
  *   return:
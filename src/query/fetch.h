@@ -43,6 +43,7 @@ extern int fetch_copy_dbval (THREAD_ENTRY * thread_p, regu_variable_node * regu_
 extern int fetch_val_list (THREAD_ENTRY * thread_p, regu_variable_list_node * regu_list, val_descr * vd,
 			   OID * class_oid, OID * obj_oid, QFILE_TUPLE tpl, int peek);
 extern void fetch_init_val_list (regu_variable_list_node * regu_list);
+extern bool fetch_is_peekable_without_tuple (const regu_variable_node * regu_var);
 
 extern void fetch_force_not_const_recursive (regu_variable_node & reguvar);
 
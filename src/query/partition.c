@@ -1588,6 +1588,23 @@ partition_get_value_from_regu_var (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE
 	break;
       }
 
+    case TYPE_CONSTANT:
+      /* Values of outer blocks can be used only if the spec drives a block executed once per outer row (e.g.
+       * correlated subqueries). Inner scans of a join are pruned before any outer row is fetched. */
+      if (pinfo->spec == NULL || !pinfo->spec->prune_with_outer_values || regu->value.dbvalptr == NULL
+	  || CHECK_REGU_VARIABLE_XASL_STATUS (regu) != XASL_SUCCESS)
+	{
+	  db_make_null (value_p);
+	  *is_value = false;
+	  return NO_ERROR;
+	}
+      if (pr_clone_value (regu->value.dbvalptr, value_p) != NO_ERROR)
+	{
+	  goto error;
+	}
+      *is_value = true;
+      break;
+
     case TYPE_FUNC:
       {
 	if (regu->value.funcp->ftype != F_MIDXKEY)
@@ -2940,6 +2957,29 @@ partition_prune_spec (THREAD_ENTRY * thread_p, val_descr * vd, access_spec_node
   return error;
 }
 
+/*
+ * partition_reset_spec_pruning () - forget the partitions pruned for an access spec
+ * return : void
+ * thread_p (in) :
+ * spec (in)     : access spec
+ *
+ * Note: The spec is pruned again the next time it is opened. The reset does
+ *	 not depend on spec->parts: pruning that found no partition leaves it
+ *	 NULL, and a spec pruned with the values of outer blocks may find
+ *	 partitions for the next outer row.
+ */
+void
+partition_reset_spec_pruning (THREAD_ENTRY * thread_p, access_spec_node * spec)
+{
+  if (spec->parts != NULL)
+    {
+      db_private_free (thread_p, spec->parts);
+      spec->parts = NULL;
+    }
+  spec->curent = NULL;
+  spec->pruned = false;
+}
+
 /*
  * partition_find_partition_for_record () - find the partition in which a
  *					    record should be placed
@@ -129,6 +129,12 @@ execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int var_cnt, const
 
   if (*list_idp == NULL)
     {
+      if (clt_cache_time != NULL && srv_cache_time != NULL && CACHE_TIME_EQ (clt_cache_time, srv_cache_time))
+	{
+	  /* the result held by the client is still valid; the server did not ship it again */
+	  return NO_ERROR;
+	}
+
       return ((ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
     }
 
@@ -555,7 +555,10 @@ static int qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE *
 					   QFILE_TUPLE_RECORD * tplrec);
 static void qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
 static int qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
-				   ANALYTIC_EVAL_TYPE * analytic_eval, QFILE_TUPLE_RECORD * tplrec, bool is_last);
+				   ANALYTIC_EVAL_TYPE * analytic_eval, SORT_LIST * input_sort_list,
+				   QFILE_TUPLE_RECORD * tplrec, bool is_last);
+static bool qexec_analytic_is_input_sorted (SORT_LIST * sort_list, SORT_LIST * input_sort_list);
+static int qexec_analytic_put_sorted_input (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state);
 static void qexec_update_btree_unique_stats_info (THREAD_ENTRY * thread_p, multi_index_unique_stats * info,
 						  const HEAP_SCANCACHE * scan_cache);
 static int qexec_prune_spec (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec, VAL_DESCR * vd,
@@ -669,6 +672,7 @@ static BH_CMP_RESULT qexec_topn_compare (const void *left, const void *right, BH
 static BH_CMP_RESULT qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec);
 static TOPN_STATUS qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * sort_stop,
 					    QFILE_TUPLE_DESCRIPTOR * tpldescr);
+static bool qexec_topn_can_skip_row (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, VAL_DESCR * vd);
 static int qexec_topn_tuples_to_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 					 bool is_final);
 static void qexec_clear_topn_tuple (THREAD_ENTRY * thread_p, TOPN_TUPLE * tuple, int count);
@@ -1160,6 +1164,12 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 	  GOTO_EXIT_ON_ERROR;
 	}
 
+      if (xasl->topn_items != NULL && qexec_topn_can_skip_row (thread_p, xasl->topn_items, &xasl_state->vd))
+	{
+	  /* the row cannot enter the top-n; do not evaluate the rest of the output list */
+	  return NO_ERROR;
+	}
+
       tpldescr_status = qexec_generate_tuple_descriptor (thread_p, xasl->list_id, xasl->outptr_list, &xasl_state->vd);
       if (tpldescr_status == QPROC_TPLDESCR_FAILURE)
 	{
@@ -1832,13 +1842,8 @@ qexec_clear_access_spec_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, ACCES
 
       memset (&p->s_id.scan_stats, 0, sizeof (SCAN_STATS));
 
-      if (p->parts != NULL)
-	{
-	  db_private_free (thread_p, p->parts);
-	  p->parts = NULL;
-	  p->curent = NULL;
-	  p->pruned = false;
-	}
+      /* a spec pruned with outer values may have found no partition; it is pruned again all the same */
+      partition_reset_spec_pruning (thread_p, p);
 
       if (XASL_IS_FLAGED (xasl_p, XASL_DECACHE_CLONE))
 	{
@@ -2327,6 +2332,11 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, bool is_final)
 	      db_private_free_and_init (thread_p, xasl->topn_items->tuples);
 	    }
 
+	  if (xasl->topn_items->sort_regus != NULL)
+	    {
+	      db_private_free_and_init (thread_p, xasl->topn_items->sort_regus);
+	    }
+
 	  db_private_free_and_init (thread_p, xasl->topn_items);
 	}
 
@@ -6788,13 +6798,10 @@ qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST
 
 exit_on_error:
 
-  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && curr_spec->parts != NULL)
+  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS)
     {
       /* reset pruning info */
-      db_private_free (thread_p, curr_spec->parts);
-      curr_spec->parts = NULL;
-      curr_spec->curent = NULL;
-      curr_spec->pruned = false;
+      partition_reset_spec_pruning (thread_p, curr_spec);
     }
 
   ASSERT_ERROR_AND_SET (error_code);
@@ -6868,13 +6875,11 @@ qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
 	}
     }
 
-  /* reset pruning info */
-  if (curr_spec->type == TARGET_CLASS && curr_spec->parts != NULL)
+  /* reset pruning info; a spec pruned with outer values is pruned again for the next outer row even if no partition
+   * was found for this one */
+  if (curr_spec->type == TARGET_CLASS && (curr_spec->parts != NULL || curr_spec->prune_with_outer_values))
     {
-      db_private_free (thread_p, curr_spec->parts);
-      curr_spec->parts = NULL;
-      curr_spec->curent = NULL;
-      curr_spec->pruned = false;
+      partition_reset_spec_pruning (thread_p, curr_spec);
 
       /* init btid */
       if (curr_spec->indexptr)
@@ -14244,6 +14249,10 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 		    {
 		      specp->fixed_scan = (xptr == fixed_scan_xasl);
 
+		      /* the driving scan of a block is opened after the outer blocks fetched their current row, so
+		       * correlated values may be used to prune its partitions */
+		      specp->prune_with_outer_values = (level == 0);
+
 		      /* set if the scan will be done in a grouped manner */
 		      if ((level == 0 && xptr->scan_ptr == NULL) && (QPROC_MAX_GROUPED_SCAN_CNT > 0))
 			{
@@ -14570,13 +14579,17 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
       if (xasl->type == BUILDLIST_PROC && xasl->proc.buildlist.a_eval_list)
 	{
 	  ANALYTIC_EVAL_TYPE *eval_list;
+	  SORT_LIST *input_sort_list = NULL;
 	  for (eval_list = xasl->proc.buildlist.a_eval_list; eval_list; eval_list = eval_list->next)
 	    {
-	      if (qexec_execute_analytic (thread_p, xasl, xasl_state, eval_list, &tplrec, (eval_list->next == NULL)) !=
-		  NO_ERROR)
+	      if (qexec_execute_analytic (thread_p, xasl, xasl_state, eval_list, input_sort_list, &tplrec,
+					  (eval_list->next == NULL)) != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
+
+	      /* the output of an evaluation is ordered by its sort list */
+	      input_sort_list = eval_list->sort_list;
 	    }
 	}
 
@@ -19455,12 +19468,14 @@ query_multi_range_opt_check_specs (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
  *   xasl(in)   :
  *   xasl_state(in) : XASL tree state information
  *   analytic_func_p(in): Analytic function pointer
+ *   input_sort_list(in): sort list the input is already ordered by, NULL if unordered
  *   tplrec(out) : Tuple record descriptor to store result tuples
  *   next_func(out) : next unprocessed function
  */
 static int
 qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
-			ANALYTIC_EVAL_TYPE * analytic_eval, QFILE_TUPLE_RECORD * tplrec, bool is_last)
+			ANALYTIC_EVAL_TYPE * analytic_eval, SORT_LIST * input_sort_list, QFILE_TUPLE_RECORD * tplrec,
+			bool is_last)
 {
   QFILE_LIST_ID *list_id = xasl->list_id;
   BUILDLIST_PROC_NODE *buildlist = &xasl->proc.buildlist;
@@ -19582,21 +19597,32 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
   interm_scan_id.keep_page_on_finish = 1;
   analytic_state.interm_scan = &interm_scan_id;
 
-  /*
-   * Now load up the sort module and set it off...
-   */
-
-  estimated_pages = qfile_get_estimated_pages_for_sorting (list_id, &analytic_state.key_info);
-
   /* number of sort keys is always less than list file column count, as sort columns are included */
   analytic_state.key_info.use_original = 1;
   analytic_state.cmp_fn = &qfile_compare_partial_sort_record;
 
-  if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
-		     &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
-		     SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+  if (qexec_analytic_is_input_sorted (analytic_eval->sort_list, input_sort_list))
     {
-      GOTO_EXIT_ON_ERROR;
+      /* the previous evaluation left the input in a compatible order; stream it through without sorting */
+      if (qexec_analytic_put_sorted_input (thread_p, &analytic_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  else
+    {
+      /*
+       * Now load up the sort module and set it off...
+       */
+
+      estimated_pages = qfile_get_estimated_pages_for_sorting (list_id, &analytic_state.key_info);
+
+      if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
+			 &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
+			 SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
     }
 
   /* check sort error */
@@ -20173,6 +20199,98 @@ exit_on_error:
   goto wrapup;
 }
 
+/*
+ * qexec_analytic_is_input_sorted () - check if the input of an analytic evaluation needs no sorting
+ *   return: true if the input is already ordered as required by sort_list
+ *   sort_list(in): sort list of the analytic evaluation
+ *   input_sort_list(in): sort list the input is ordered by, NULL if unordered
+ *
+ *   Note: The input is ordered if sort_list is a prefix of input_sort_list. Both lists refer to the same columns since
+ *	   all evaluations read lists built by a_outptr_list_interm.
+ */
+static bool
+qexec_analytic_is_input_sorted (SORT_LIST * sort_list, SORT_LIST * input_sort_list)
+{
+  for (; sort_list != NULL; sort_list = sort_list->next, input_sort_list = input_sort_list->next)
+    {
+      if (input_sort_list == NULL)
+	{
+	  return false;
+	}
+
+      if (sort_list->pos_descr.pos_no != input_sort_list->pos_descr.pos_no
+	  || sort_list->s_order != input_sort_list->s_order || sort_list->s_nulls != input_sort_list->s_nulls)
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qexec_analytic_put_sorted_input () - feed an already ordered input to the analytic evaluation
+ *   return: NO_ERROR, or ER_code
+ *   analytic_state(in): analytic state
+ *
+ *   Note: Sort keys are built exactly as for sort_listfile and passed one by one to qexec_analytic_put_next, so
+ *	   groups are computed in a single pass over the input list file.
+ */
+static int
+qexec_analytic_put_sorted_input (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state)
+{
+  RECDES key_rec;
+  SORT_STATUS status;
+  int error = NO_ERROR;
+
+  key_rec.area_size = DB_PAGESIZE;
+  key_rec.length = 0;
+  key_rec.data = (char *) db_private_alloc (thread_p, key_rec.area_size);
+  if (key_rec.data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) key_rec.area_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  while (true)
+    {
+      status = qexec_analytic_get_next (thread_p, &key_rec, analytic_state);
+      if (status == SORT_NOMORE_RECS)
+	{
+	  break;
+	}
+      else if (status == SORT_REC_DOESNT_FIT)
+	{
+	  /* the input scan was moved back; enlarge the key record and retry */
+	  char *data = (char *) db_private_realloc (thread_p, key_rec.data, key_rec.length);
+	  if (data == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) key_rec.length);
+	      error = ER_OUT_OF_VIRTUAL_MEMORY;
+	      break;
+	    }
+	  key_rec.data = data;
+	  key_rec.area_size = key_rec.length;
+	  continue;
+	}
+      else if (status != SORT_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  break;
+	}
+
+      error = qexec_analytic_put_next (thread_p, &key_rec, analytic_state);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+  db_private_free_and_init (thread_p, key_rec.data);
+
+  return error;
+}
+
 /*
  * qexec_analytic_eval_instnum_pred () - evaluate inst_num() predicate
  *   returns: error code or NO_ERROR
@@ -24075,8 +24193,9 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   BINARY_HEAP *heap = NULL;
   DB_VALUE ubound_val;
   REGU_VARIABLE_LIST var_list = NULL;
+  SORT_LIST *sort_item = NULL;
   TOPN_TUPLES *top_n = NULL;
-  int error = NO_ERROR, ubound = 0, count = 0;
+  int error = NO_ERROR, ubound = 0, count = 0, sort_count = 0, i;
   UINT64 estimated_size = 0, max_size = 0;
   static int sr_nbuffers = prm_get_integer_value (PRM_ID_SR_NBUFFERS);
 
@@ -24201,6 +24320,8 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
 
   top_n->max_size = max_size;
   top_n->total_size = 0;
+  top_n->tuples = NULL;
+  top_n->sort_regus = NULL;
 
   top_n->tuples = (TOPN_TUPLE *) db_private_alloc (thread_p, ubound * sizeof (TOPN_TUPLE));
   if (top_n->tuples == NULL)
@@ -24221,6 +24342,48 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   top_n->sort_items = xasl->orderby_list;
   top_n->values_count = count;
 
+  /* Remember the regu variables of the sort items when all of them can be read without evaluating the output list.
+   * Once the heap is full, they are used to drop rows which cannot enter the top-n before their tuple is built. */
+  sort_count = 0;
+  for (sort_item = xasl->orderby_list; sort_item != NULL; sort_item = sort_item->next)
+    {
+      sort_count++;
+    }
+
+  top_n->sort_regus = (REGU_VARIABLE **) db_private_alloc (thread_p, sort_count * sizeof (REGU_VARIABLE *));
+  if (top_n->sort_regus == NULL)
+    {
+      error = ER_FAILED;
+      goto error_return;
+    }
+
+  for (sort_item = xasl->orderby_list, i = 0; sort_item != NULL; sort_item = sort_item->next, i++)
+    {
+      top_n->sort_regus[i] = NULL;
+
+      /* find the visible column of the sort item */
+      count = 0;
+      for (var_list = xasl->outptr_list->valptrp; var_list != NULL; var_list = var_list->next)
+	{
+	  if (REGU_VARIABLE_IS_FLAGED (&var_list->value, REGU_VARIABLE_HIDDEN_COLUMN))
+	    {
+	      continue;
+	    }
+	  if (count == sort_item->pos_descr.pos_no)
+	    {
+	      break;
+	    }
+	  count++;
+	}
+
+      if (var_list == NULL || !fetch_is_peekable_without_tuple (&var_list->value))
+	{
+	  db_private_free_and_init (thread_p, top_n->sort_regus);
+	  break;
+	}
+      top_n->sort_regus[i] = &var_list->value;
+    }
+
   xasl->topn_items = top_n;
 
   return NO_ERROR;
@@ -24236,6 +24399,10 @@ error_return:
 	{
 	  db_private_free (thread_p, top_n->tuples);
 	}
+      if (top_n->sort_regus != NULL)
+	{
+	  db_private_free (thread_p, top_n->sort_regus);
+	}
       db_private_free (thread_p, top_n);
     }
 
@@ -24451,6 +24618,70 @@ qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, QFIL
   return TOPN_SUCCESS;
 }
 
+/*
+ * qexec_topn_can_skip_row () - check if the current row can be discarded without building its tuple
+ * return : true if the row cannot enter the top-n
+ * thread_p (in)  :
+ * topn_items (in): topn items
+ * vd (in)	  : value descriptor
+ *
+ * Note: The root of a full heap is the threshold a row must beat. The sort keys of the row are peeked and compared
+ *	 with it exactly like qexec_add_tuple_to_topn does, so that the rest of the output list is evaluated only for
+ *	 rows which may replace the root. When a key cannot be peeked or compared safely the row is kept and handled
+ *	 by the regular path.
+ */
+static bool
+qexec_topn_can_skip_row (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, VAL_DESCR * vd)
+{
+  TOPN_TUPLE *heap_max = NULL;
+  SORT_LIST *key = NULL;
+  REGU_VARIABLE *regu = NULL;
+  DB_VALUE *peek_val = NULL;
+  BH_CMP_RESULT res = BH_EQ;
+  int i;
+
+  if (topn_items->sort_regus == NULL || !bh_is_full (topn_items->heap))
+    {
+      return false;
+    }
+
+  if (!bh_peek_max (topn_items->heap, &heap_max))
+    {
+      assert (false);
+      return false;
+    }
+  assert (heap_max != NULL);
+
+  for (key = topn_items->sort_items, i = 0; key != NULL; key = key->next, i++)
+    {
+      regu = topn_items->sort_regus[i];
+      if (fetch_peek_dbval (thread_p, regu, vd, NULL, NULL, NULL, &peek_val) != NO_ERROR)
+	{
+	  /* let the regular path report the error */
+	  er_clear ();
+	  return false;
+	}
+
+      if (!DB_IS_NULL (peek_val)
+	  && (DB_VALUE_DOMAIN_TYPE (peek_val) != TP_DOMAIN_TYPE (regu->domain)
+	      || DB_VALUE_DOMAIN_TYPE (peek_val) == DB_TYPE_NUMERIC || DB_VALUE_DOMAIN_TYPE (peek_val) == DB_TYPE_OID))
+	{
+	  /* the value is cast when the tuple is built; compare it only after that */
+	  return false;
+	}
+
+      res = qexec_topn_cmpval (&heap_max->values[key->pos_descr.pos_no], peek_val, key);
+      if (res == BH_EQ)
+	{
+	  continue;
+	}
+      return (res == BH_LT);
+    }
+
+  /* equal to the root; qexec_add_tuple_to_topn would not add it either */
+  return true;
+}
+
 /*
  * qexec_topn_tuples_to_list_id () - put tuples from the internal heap to the
  *				   output listfile
@@ -24605,6 +24836,10 @@ cleanup:
 	{
 	  db_private_free (thread_p, xasl->topn_items->tuples);
 	}
+      if (xasl->topn_items->sort_regus != NULL)
+	{
+	  db_private_free (thread_p, xasl->topn_items->sort_regus);
+	}
       db_private_free (thread_p, xasl->topn_items);
       xasl->topn_items = NULL;
     }
@@ -567,7 +567,8 @@ enum
   XASL_CACHE_PINNED_REFERENCE = 0x2000,
   EXECUTE_QUERY_WITHOUT_DATA_BUFFERS = 0x4000,
   EXECUTE_QUERY_WITH_COMMIT = 0x8000,
-  TRAN_AUTO_COMMIT = 0x000010000
+  TRAN_AUTO_COMMIT = 0x000010000,
+  EXECUTE_QUERY_WITH_END_QUERIES = 0x000020000
 };
 
 #define DO_NOT_COLLECT_EXEC_STATS(flag)    ((flag) & DONT_COLLECT_EXEC_STATS)
@@ -580,6 +581,7 @@ enum
 #define IS_XASL_CACHE_PINNED_REFERENCE(flag)   (((flag) & XASL_CACHE_PINNED_REFERENCE) != 0)
 #define IS_QUERY_EXECUTED_WITHOUT_DATA_BUFFERS(flag)   (((flag) & EXECUTE_QUERY_WITHOUT_DATA_BUFFERS) != 0)
 #define IS_QUERY_EXECUTE_WITH_COMMIT(flag)   (((flag) & EXECUTE_QUERY_WITH_COMMIT) != 0)
+#define IS_QUERY_EXECUTE_WITH_END_QUERIES(flag)   (((flag) & EXECUTE_QUERY_WITH_END_QUERIES) != 0)
 #define IS_TRAN_AUTO_COMMIT(flag)   (((flag) & TRAN_AUTO_COMMIT) != 0)
 
 typedef int QUERY_FLAG;
@@ -1420,6 +1420,15 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 	    {
 	      /* found the cached result */
 	      CACHE_TIME_MAKE (server_cache_time_p, &list_cache_entry_p->time_created);
+
+	      /* The list cache entry is dropped whenever one of its classes is modified, so an unchanged creation
+	       * time means the copy the client already holds is still valid. Skip cloning the list file and shipping
+	       * its first page; the caller sees a NULL list with equal cache times. */
+	      if (client_cache_time_p != NULL && CACHE_TIME_EQ (client_cache_time_p, server_cache_time_p))
+		{
+		  (void) qfile_end_use_of_list_cache_entry (thread_p, list_cache_entry_p, false);
+		  goto end;
+		}
 	    }
 	}
     }
@@ -4503,6 +4503,7 @@ stx_build_access_spec_type (THREAD_ENTRY * thread_p, char *ptr, ACCESS_SPEC_TYPE
   access_spec->parts = NULL;
   access_spec->curent = NULL;
   access_spec->pruned = false;
+  access_spec->prune_with_outer_values = false;
 
   access_spec->clear_value_at_clone_decache = xasl_unpack_info->use_xasl_clone;
   ptr = or_unpack_int (ptr, &offset);
@@ -932,6 +932,7 @@ struct topn_tuples
   int values_count;		/* number of values in a tuple */
   UINT64 total_size;		/* size in bytes of stored tuples */
   UINT64 max_size;		/* maximum size which tuples may occupy */
+  REGU_VARIABLE **sort_regus;	/* regu variables of the sort items, used to test a row before its tuple is built */
 };
 
 struct topn_tuple
@@ -971,6 +972,7 @@ struct access_spec_node
   bool grouped_scan;		/* grouped or regular scan? it is never true!!! */
   bool fixed_scan;		/* scan pages are kept fixed? */
   bool pruned;			/* true if partition pruning has been performed */
+  bool prune_with_outer_values;	/* true if values of outer blocks are loaded when this spec is pruned */
   bool clear_value_at_clone_decache;	/* true, if need to clear s_dbval at clone decache */
 #endif				/* #if defined (SERVER_MODE) || defined (SA_MODE) */
 };
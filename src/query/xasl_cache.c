@@ -32,6 +32,7 @@
 #include "perf_monitor.h"
 #include "query_executor.h"
 #include "query_manager.h"
+#include "session.h"
 #include "statistics_sr.h"
 #include "stream_to_xasl.h"
 #include "thread_entry.hpp"
@@ -1824,6 +1825,9 @@ xcache_invalidate_entries (THREAD_ENTRY * thread_p, bool (*invalidate_check) (XA
 	      /* I don't think this is expected. */
 	      assert (false);
 	    }
+
+	  /* prepared statements shared between sessions may describe a changed schema */
+	  session_remove_shared_prepared_statements (thread_p, &delete_xids[xid_index].sha1);
 	}
       n_delete_xids = 0;
     }
@@ -53,6 +53,7 @@
 #include "thread_lockfree_hash_map.hpp"
 #include "thread_manager.hpp"
 #include "xasl_cache.h"
+#include "session_shared_statements.hpp"
 
 #if !defined(SERVER_MODE)
 #define pthread_mutex_init(a, b)
@@ -66,6 +67,7 @@ static int rv;
 #define SESSIONS_HASH_SIZE 1000
 #define MAX_SESSION_VARIABLES_COUNT 20
 #define MAX_PREPARED_STATEMENTS_COUNT 20
+#define MAX_SHARED_STATEMENTS_COUNT 4096
 
 typedef struct session_info SESSION_INFO;
 struct session_info
@@ -195,11 +197,20 @@ typedef struct active_sessions
 /* the active sessions storage */
 static ACTIVE_SESSIONS sessions;
 
+/* prepared statements shared by all sessions; they are keyed by the user of the publishing transaction and the
+ * share key built by its client from the query string parameters and the statement text */
+// *INDENT-OFF*
+static cubsession::shared_statement_registry shared_Statements (MAX_SHARED_STATEMENTS_COUNT);
+// *INDENT-ON*
+
 static int session_remove_expired_sessions (THREAD_ENTRY * thread_p);
 
 static int session_check_timeout (SESSION_STATE * session_p, SESSION_INFO * active_sessions, bool * remove);
 
 static void session_free_prepared_statement (PREPARED_STATEMENT * stmt_p);
+static PREPARED_STATEMENT *session_copy_prepared_statement (const char *name, const char *alias_print,
+							    const SHA1Hash * sha1, const char *info, int info_len);
+static int session_get_shared_statement_key (THREAD_ENTRY * thread_p, const char *key, std::string & shared_key);
 
 static int session_add_variable (SESSION_STATE * state_p, const DB_VALUE * name, DB_VALUE * value);
 
@@ -624,6 +635,8 @@ session_states_finalize (THREAD_ENTRY * thread_p)
 
   /* destroy hash and freelist */
   sessions.states_hashmap.destroy ();
+
+  session_remove_shared_prepared_statements (thread_p, NULL);
 }
 
 /*
@@ -1909,6 +1922,255 @@ session_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name)
   return NO_ERROR;
 }
 
+/*
+ * session_copy_prepared_statement () - allocate a prepared statement holding copies of the arguments
+ * return : the new statement or NULL on error
+ * name (in)	     : statement name (or share key)
+ * alias_print (in)  : the printed compiled statement
+ * sha1 (in)	     : sha1 hash for printed compiled statement
+ * info (in)	     : serialized prepared statement info
+ * info_len (in)     : serialized buffer length
+ */
+static PREPARED_STATEMENT *
+session_copy_prepared_statement (const char *name, const char *alias_print, const SHA1Hash * sha1, const char *info,
+				 int info_len)
+{
+  PREPARED_STATEMENT *stmt_p;
+
+  stmt_p = (PREPARED_STATEMENT *) calloc (1, sizeof (PREPARED_STATEMENT));
+  if (stmt_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (PREPARED_STATEMENT));
+      return NULL;
+    }
+
+  stmt_p->name = strdup (name);
+  stmt_p->alias_print = strdup (alias_print);
+  stmt_p->info = (char *) malloc (info_len);
+  if (stmt_p->name == NULL || stmt_p->alias_print == NULL || stmt_p->info == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) info_len);
+      session_free_prepared_statement (stmt_p);
+      return NULL;
+    }
+  memcpy (stmt_p->info, info, info_len);
+  stmt_p->info_length = info_len;
+  stmt_p->sha1 = *sha1;
+
+  return stmt_p;
+}
+
+/*
+ * session_get_shared_statement_key () - build the registry key of a shared prepared statement
+ * return : NO_ERROR or error code
+ * thread_p (in)     : thread entry
+ * key (in)	     : share key built by the client
+ * shared_key (out)  : the key prefixed with the user of the current transaction
+ *
+ * Note: The user is taken from the transaction, not from the client key, so
+ *	 that a client cannot reach the statements published by another user.
+ */
+static int
+session_get_shared_statement_key (THREAD_ENTRY * thread_p, const char *key, std::string & shared_key)
+{
+  LOG_TDES *tdes;
+  const char *user_name;
+
+  tdes = LOG_FIND_CURRENT_TDES (thread_p);
+  if (tdes == NULL)
+    {
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_UNKNOWN_TRANINDEX, 1,
+	      LOG_FIND_THREAD_TRAN_INDEX (thread_p));
+      return ER_LOG_UNKNOWN_TRANINDEX;
+    }
+
+  user_name = tdes->client.get_db_user ();
+  if (user_name == NULL || user_name[0] == '\0')
+    {
+      /* not logged in; nothing is shared */
+      return ER_FAILED;
+    }
+
+  shared_key.assign (user_name);
+  shared_key.push_back ('\n');
+  shared_key.append (key);
+
+  return NO_ERROR;
+}
+
+/*
+ * session_share_prepared_statement () - publish a compiled prepared statement to all sessions
+ * return : NO_ERROR or error code
+ * thread_p (in)     : thread entry
+ * key (in)	     : share key
+ * alias_print (in)  : the printed compiled statement
+ * sha1 (in)	     : sha1 hash for printed compiled statement
+ * info (in)	     : serialized prepared statement info
+ * info_len (in)     : serialized buffer length
+ *
+ * Note: The arguments are copied. The statement is not shared if the
+ *	 authorization it was compiled against may have changed since the
+ *	 transaction started, see cubsession::shared_statement_registry.
+ */
+int
+session_share_prepared_statement (THREAD_ENTRY * thread_p, const char *key, const char *alias_print,
+				  const SHA1Hash * sha1, const char *info, int info_len)
+{
+  LOG_TDES *tdes;
+  std::string shared_key;
+
+  if (key == NULL || alias_print == NULL || info == NULL || info_len <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (session_get_shared_statement_key (thread_p, key, shared_key) != NO_ERROR)
+    {
+      er_clear ();
+      return NO_ERROR;
+    }
+
+  tdes = LOG_FIND_CURRENT_TDES (thread_p);
+
+  // *INDENT-OFF*
+  cubsession::shared_statement stmt (alias_print, *sha1, info, (size_t) info_len);
+  // *INDENT-ON*
+
+  /* a refused statement is still prepared for this session */
+  (void) shared_Statements.publish (shared_key, tdes->authorization_version, stmt);
+
+  return NO_ERROR;
+}
+
+/*
+ * session_attach_shared_prepared_statement () - create a prepared statement in this session from a statement
+ *						 shared by another session
+ * return : NO_ERROR or error code
+ * thread_p (in)  : thread entry
+ * name (in)	  : the name of the statement in this session
+ * key (in)	  : share key
+ * found (out)	  : true if a shared statement was found and attached
+ *
+ * Note: Only statements published by the same user are attached. A shared
+ *	 statement whose XASL was dropped from the cache is removed and not
+ *	 attached; the client compiles the statement in that case.
+ */
+int
+session_attach_shared_prepared_statement (THREAD_ENTRY * thread_p, const char *name, const char *key, bool * found)
+{
+  PREPARED_STATEMENT *stmt_p = NULL;
+  XASL_CACHE_ENTRY *xasl_entry = NULL;
+  SHA1Hash sha1;
+  std::string shared_key;
+  int err = NO_ERROR;
+  // *INDENT-OFF*
+  cubsession::shared_statement shared;
+  // *INDENT-ON*
+
+  *found = false;
+
+  if (session_get_shared_statement_key (thread_p, key, shared_key) != NO_ERROR)
+    {
+      er_clear ();
+      return NO_ERROR;
+    }
+
+  if (!shared_Statements.find (shared_key, shared))
+    {
+      /* not shared; let the client compile it */
+      return NO_ERROR;
+    }
+
+  stmt_p = session_copy_prepared_statement (name, shared.m_alias_print.c_str (), &shared.m_sha1,
+					    shared.m_info.data (), (int) shared.m_info.size ());
+  if (stmt_p == NULL)
+    {
+      er_clear ();
+      return NO_ERROR;
+    }
+
+  sha1 = stmt_p->sha1;
+  err = xcache_find_sha1 (thread_p, &sha1, XASL_CACHE_SEARCH_GENERIC, &xasl_entry, NULL);
+  if (err != NO_ERROR || xasl_entry == NULL)
+    {
+      session_free_prepared_statement (stmt_p);
+      session_remove_shared_prepared_statements (thread_p, &sha1);
+      er_clear ();
+      return NO_ERROR;
+    }
+  xcache_unfix (thread_p, xasl_entry);
+
+  err = session_create_prepared_statement (thread_p, stmt_p->name, stmt_p->alias_print, &stmt_p->sha1, stmt_p->info,
+					   stmt_p->info_length);
+  if (err != NO_ERROR)
+    {
+      session_free_prepared_statement (stmt_p);
+      return err;
+    }
+
+  /* the session owns the copied members now */
+  free_and_init (stmt_p);
+  *found = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * session_remove_shared_prepared_statements () - remove shared prepared statements
+ * return : void
+ * thread_p (in)  : thread entry
+ * sha1 (in)	  : remove the statements compiled to this XASL, or all statements if NULL
+ */
+void
+session_remove_shared_prepared_statements (THREAD_ENTRY * thread_p, const SHA1Hash * sha1)
+{
+  if (sha1 == NULL)
+    {
+      shared_Statements.clear ();
+    }
+  else
+    {
+      shared_Statements.remove (*sha1);
+    }
+}
+
+/*
+ * session_get_authorization_version () - get the authorization version shared prepared statements are checked against
+ * return : authorization version
+ */
+int
+session_get_authorization_version (void)
+{
+  return shared_Statements.get_authorization_version ();
+}
+
+/*
+ * session_begin_authorization_change () - a transaction is about to modify the authorization catalogs
+ * return : void
+ * thread_p (in)  : thread entry
+ *
+ * Note: No prepared statement is shared until the change ends.
+ */
+void
+session_begin_authorization_change (THREAD_ENTRY * thread_p)
+{
+  shared_Statements.begin_authorization_change ();
+}
+
+/*
+ * session_end_authorization_change () - a transaction that modified the authorization catalogs committed or aborted
+ * return : void
+ * thread_p (in)  : thread entry
+ *
+ * Note: The shared prepared statements are dropped, because the clients
+ *	 that compiled them may no longer be allowed to run them.
+ */
+void
+session_end_authorization_change (THREAD_ENTRY * thread_p)
+{
+  shared_Statements.end_authorization_change ();
+}
+
 /*
  * login_user () - login user
  * return	  : error code
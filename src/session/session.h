@@ -58,6 +58,14 @@ extern int session_create_prepared_statement (THREAD_ENTRY * thread_p, char *nam
 extern int session_get_prepared_statement (THREAD_ENTRY * thread_p, const char *name, char **info, int *info_len,
 					   xasl_cache_ent ** xasl_entry);
 extern int session_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name);
+extern int session_share_prepared_statement (THREAD_ENTRY * thread_p, const char *key, const char *alias_print,
+					     const SHA1Hash * sha1, const char *info, int info_len);
+extern int session_attach_shared_prepared_statement (THREAD_ENTRY * thread_p, const char *name, const char *key,
+						     bool * found);
+extern void session_remove_shared_prepared_statements (THREAD_ENTRY * thread_p, const SHA1Hash * sha1);
+extern int session_get_authorization_version (void);
+extern void session_begin_authorization_change (THREAD_ENTRY * thread_p);
+extern void session_end_authorization_change (THREAD_ENTRY * thread_p);
 extern int login_user (THREAD_ENTRY * thread_p, const char *username);
 extern int session_set_session_variables (THREAD_ENTRY * thread_p, DB_VALUE * values, const int count);
 extern int session_get_variable (THREAD_ENTRY * thread_p, const DB_VALUE * name, DB_VALUE * result);
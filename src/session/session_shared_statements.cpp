@@ -0,0 +1,155 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// session_shared_statements.cpp - prepared statements shared by all sessions of the server
+//
+
+#include "session_shared_statements.hpp"
+
+#include <cassert>
+#include <cstring>
+
+namespace cubsession
+{
+  shared_statement::shared_statement (const char *alias_print, const SHA1Hash &sha1, const char *info,
+				      std::size_t info_length)
+    : m_alias_print (alias_print)
+    , m_sha1 (sha1)
+    , m_info (info, info_length)
+  {
+  }
+
+  shared_statement_registry::shared_statement_registry (std::size_t max_count)
+    : m_mutex ()
+    , m_statements ()
+    , m_max_count (max_count)
+    , m_authorization_version (0)
+    , m_authorization_changes (0)
+  {
+  }
+
+  int
+  shared_statement_registry::get_authorization_version () const
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    return m_authorization_version;
+  }
+
+  void
+  shared_statement_registry::begin_authorization_change ()
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    m_authorization_changes++;
+  }
+
+  void
+  shared_statement_registry::end_authorization_change ()
+  {
+    map_type removed;
+
+    {
+      std::lock_guard<std::mutex> lock (m_mutex);
+
+      assert (m_authorization_changes > 0);
+      m_authorization_changes--;
+      m_authorization_version++;
+      removed.swap (m_statements);
+    }
+    // removed statements are freed outside the mutex
+  }
+
+  bool
+  shared_statement_registry::publish (const std::string &key, int authorization_version,
+				      const shared_statement &stmt)
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    if (m_authorization_changes > 0 || authorization_version != m_authorization_version)
+      {
+	// the statement may have been checked against authorization that is changing or was changed
+	return false;
+      }
+
+    map_type::iterator it = m_statements.find (key);
+    if (it != m_statements.end ())
+      {
+	it->second = stmt;
+	return true;
+      }
+
+    if (m_statements.size () >= m_max_count)
+      {
+	return false;
+      }
+
+    m_statements.emplace (key, stmt);
+    return true;
+  }
+
+  bool
+  shared_statement_registry::find (const std::string &key, shared_statement &stmt) const
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    map_type::const_iterator it = m_statements.find (key);
+    if (it == m_statements.end ())
+      {
+	return false;
+      }
+
+    stmt = it->second;
+    return true;
+  }
+
+  void
+  shared_statement_registry::remove (const SHA1Hash &sha1)
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    for (map_type::iterator it = m_statements.begin (); it != m_statements.end ();)
+      {
+	if (std::memcmp (&it->second.m_sha1, &sha1, sizeof (SHA1Hash)) == 0)
+	  {
+	    it = m_statements.erase (it);
+	  }
+	else
+	  {
+	    ++it;
+	  }
+      }
+  }
+
+  void
+  shared_statement_registry::clear ()
+  {
+    map_type removed;
+
+    {
+      std::lock_guard<std::mutex> lock (m_mutex);
+      removed.swap (m_statements);
+    }
+  }
+
+  std::size_t
+  shared_statement_registry::size () const
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    return m_statements.size ();
+  }
+} // namespace cubsession
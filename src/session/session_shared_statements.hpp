@@ -0,0 +1,101 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// session_shared_statements.hpp - prepared statements shared by all sessions of the server
+//
+
+#ifndef _SESSION_SHARED_STATEMENTS_HPP_
+#define _SESSION_SHARED_STATEMENTS_HPP_
+
+#include "sha1.h"
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cubsession
+{
+  //
+  // shared_statement - what a session needs to prepare a statement without compiling it
+  //
+  struct shared_statement
+  {
+    std::string m_alias_print;    // the printed compiled statement
+    SHA1Hash m_sha1;              // sha1 of m_alias_print; identifies the XASL cache entry
+    std::string m_info;           // serialized prepared statement info
+
+    shared_statement () = default;
+    shared_statement (const char *alias_print, const SHA1Hash &sha1, const char *info, std::size_t info_length);
+  };
+
+  //
+  // shared_statement_registry - prepared statements compiled by one session and reused by the others
+  //
+  // The client checks authorization while it compiles a statement, so a statement compiled by one client may only be
+  // reused as long as the authorization it was checked against stays the same. The registry keeps an authorization
+  // version for that:
+  //
+  //    - a transaction that modifies authorization catalogs calls begin_authorization_change () before its first
+  //      change and end_authorization_change () when it commits or aborts. Ending a change drops all statements and
+  //      increments the version.
+  //    - a statement is published with the version its transaction started with. It is refused if an authorization
+  //      change is in progress or was finished since, because the client may have checked it against the old
+  //      authorization.
+  //
+  // Statements are also removed when their XASL cache entry is dropped.
+  //
+  class shared_statement_registry
+  {
+    public:
+      explicit shared_statement_registry (std::size_t max_count);
+      ~shared_statement_registry () = default;
+
+      shared_statement_registry (const shared_statement_registry &) = delete;
+      shared_statement_registry &operator= (const shared_statement_registry &) = delete;
+
+      // authorization changes
+      int get_authorization_version () const;
+      void begin_authorization_change ();
+      void end_authorization_change ();
+
+      // publish a statement compiled by a transaction that started with authorization_version; false if refused
+      bool publish (const std::string &key, int authorization_version, const shared_statement &stmt);
+      // copy the statement published with key; false if there is none
+      bool find (const std::string &key, shared_statement &stmt) const;
+
+      // remove the statements compiled to an XASL
+      void remove (const SHA1Hash &sha1);
+      // remove all statements
+      void clear ();
+
+      std::size_t size () const;
+
+    private:
+      using map_type = std::unordered_map<std::string, shared_statement>;
+
+      mutable std::mutex m_mutex;
+      map_type m_statements;
+      std::size_t m_max_count;
+      int m_authorization_version;
+      int m_authorization_changes;    // transactions that modified authorization and did not end yet
+  };
+} // namespace cubsession
+
+#endif // _SESSION_SHARED_STATEMENTS_HPP_
@@ -235,6 +235,37 @@ xsession_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name)
   return session_delete_prepared_statement (thread_p, name);
 }
 
+/*
+ * xsession_share_prepared_statement () - publish a prepared statement to all sessions
+ * return : error code or NO_ERROR
+ * thread_p (in)	: thread entry
+ * key (in)		: share key
+ * alias_print(in)	: the printed compiled statement
+ * sha1 (in)		: sha1 hash for printed compiled statement
+ * info (in)		: serialized prepared statement info
+ * info_len (in)	: serialized buffer length
+ */
+int
+xsession_share_prepared_statement (THREAD_ENTRY * thread_p, const char *key, const char *alias_print,
+				   const SHA1Hash * sha1, const char *info, int info_len)
+{
+  return session_share_prepared_statement (thread_p, key, alias_print, sha1, info, info_len);
+}
+
+/*
+ * xsession_attach_shared_prepared_statement () - prepare a statement from one shared by another session
+ * return : error code or NO_ERROR
+ * thread_p (in)  :
+ * name (in)	  : name of the prepared statement
+ * key (in)	  : share key
+ * found (out)	  : true if the statement was prepared
+ */
+int
+xsession_attach_shared_prepared_statement (THREAD_ENTRY * thread_p, const char *name, const char *key, bool * found)
+{
+  return session_attach_shared_prepared_statement (thread_p, name, key, found);
+}
+
 /*
  * xlogin_user () - login user
  * return : error code or NO_ERROR
@@ -5540,6 +5540,80 @@ xdisk_get_purpose_and_sys_lastpage (THREAD_ENTRY * thread_p, INT16 volid, DISK_V
   return volid;
 }
 
+/*
+ * disk_get_reserved_sectors_map () - Copy the sector table of a permanent volume
+ *
+ * return         : Error code
+ * thread_p (in)  : Thread entry
+ * volid (in)     : Permanent volume identifier
+ * map (out)      : One bit per sector, set if the sector is reserved. Bit (sectid % 64) of unit
+ *                  (sectid / 64), as in the sector table. System sectors are reserved. Caller must
+ *                  free it.
+ * nsects (out)   : Number of sectors of the volume
+ */
+int
+disk_get_reserved_sectors_map (THREAD_ENTRY * thread_p, VOLID volid, UINT64 ** map, DKNSECTS * nsects)
+{
+  PAGE_PTR page_volheader = NULL;
+  DISK_VOLUME_HEADER *volheader;
+  PAGE_PTR page_stab;
+  VPID vpid_stab;
+  size_t size_map;
+  size_t size_left;
+  size_t size_copy;
+  char *ptr_map;
+  int error_code = NO_ERROR;
+
+  *map = NULL;
+  *nsects = 0;
+
+  error_code = disk_get_volheader (thread_p, volid, PGBUF_LATCH_READ, &page_volheader, &volheader);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  size_map = CEIL_PTVDIV (volheader->nsect_total, DISK_STAB_UNIT_BIT_COUNT) * DISK_STAB_UNIT_SIZE_OF;
+  *map = (UINT64 *) malloc (size_map);
+  if (*map == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size_map);
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto exit;
+    }
+
+  vpid_stab.volid = volid;
+  vpid_stab.pageid = volheader->stab_first_page;
+  ptr_map = (char *) *map;
+  for (size_left = size_map; size_left > 0; size_left -= size_copy)
+    {
+      size_copy = MIN ((size_t) DB_PAGESIZE, size_left);
+
+      page_stab = pgbuf_fix (thread_p, &vpid_stab, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (page_stab == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  free_and_init (*map);
+	  goto exit;
+	}
+
+      memcpy (ptr_map, page_stab, size_copy);
+      pgbuf_unfix_and_init (thread_p, page_stab);
+
+      ptr_map += size_copy;
+      vpid_stab.pageid++;
+    }
+  assert (vpid_stab.pageid <= volheader->stab_first_page + volheader->stab_npages);
+
+  *nsects = volheader->nsect_total;
+
+exit:
+  pgbuf_unfix (thread_p, page_volheader);
+
+  return error_code;
+}
+
 /*
  * xdisk_get_total_numpages () - Return the number of total pages for the given volume
  *   return: Total Number of pages
@@ -85,6 +85,7 @@
 #include "log_common_impl.h"
 #include "log_volids.hpp"
 #include "fault_injection.h"
+#include "bit.h"
 #if defined (SERVER_MODE)
 #include "vacuum.h"
 #endif /* SERVER_MODE */
@@ -257,6 +258,9 @@
 
 #define FILEIO_END_OF_FILE                (1)
 
+/* Number of consecutive restored pages written to a volume with a single write */
+#define FILEIO_RESTORE_WRITE_BATCH_PAGES  64
+
 /* Minimum flush rate 40MB/s */
 #define FILEIO_MIN_FLUSH_PAGES_PER_SEC    (41943040 / IO_PAGESIZE)
 /* TODO: Growth/drop flush rate values can be tweaked. They have been set to
@@ -299,6 +303,38 @@
   fileio_lock_region(fd, F_SETLK, F_UNLCK, offset, whence, len)
 #endif /* WINDOWS */
 
+/*
+ * Pages of a volume being restored are buffered here while their page ids are consecutive, so that a run of pages
+ * costs one write instead of one per page.
+ */
+typedef struct fileio_restore_write_batch FILEIO_RESTORE_WRITE_BATCH;
+struct fileio_restore_write_batch
+{
+  char *pages;			/* FILEIO_RESTORE_WRITE_BATCH_PAGES io pages, or NULL to write pages one by one */
+  PAGEID first_page_id;		/* page id of pages[0] */
+  int num_pages;		/* number of buffered pages */
+};
+
+/* Number of sectors described by one unit of a sector map given to fileio_copy_volume */
+#define FILEIO_SECTOR_MAP_UNIT_BITS  ((int) (sizeof (UINT64) * CHAR_BIT))
+
+#if !defined (CS_MODE)
+/* Changed page tracking keeps the flushed log page of FILEIO_CHANGED_SECTORS_PER_CHUNK sectors per allocation */
+#define FILEIO_CHANGED_SECTORS_PER_CHUNK  4096
+#define FILEIO_CHANGED_SECTORS_NCHUNKS \
+  ((int) CEIL_PTVDIV (VOL_MAX_NSECTS (IO_PAGESIZE), FILEIO_CHANGED_SECTORS_PER_CHUNK))
+
+/*
+ * Changed page tracking: for every sector of a permanent volume, the highest log page id of the page lsa's flushed to
+ * it since the server started. An incremental backup skips the sectors that were not flushed since the previous backup
+ * without reading them. Nothing is persisted; a backup relies on it only when the previous backup of its level was
+ * taken after fileio_Changed_pages_start_lsa, since older changes may have been flushed by a former server process.
+ */
+static INT64 **volatile fileio_Changed_sectors[LOG_MAX_DBVOLID + 1];
+static LOG_LSA fileio_Changed_pages_start_lsa = LSA_INITIALIZER;
+static volatile bool fileio_Changed_pages_lost = false;
+#endif /* !CS_MODE */
+
 #define FILEIO_VOLINFO_INCREMENT        32
 
 #if !defined(SERVER_MODE)
@@ -534,6 +570,11 @@ static FILEIO_BACKUP_SESSION *fileio_initialize_restore (THREAD_ENTRY * thread_p
 static int fileio_read_restore (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, int toread_nbytes);
 static void *fileio_write_restore (THREAD_ENTRY * thread_p, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap, int vdes,
 				   void *io_pgptr, VOLID vol_id, PAGEID page_id, FILEIO_BACKUP_LEVEL level);
+static int fileio_add_restore_write_batch (THREAD_ENTRY * thread_p, FILEIO_RESTORE_WRITE_BATCH * batch,
+					   FILEIO_BACKUP_SESSION * session, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap,
+					   void *io_pgptr, PAGEID page_id);
+static int fileio_flush_restore_write_batch (THREAD_ENTRY * thread_p, FILEIO_RESTORE_WRITE_BATCH * batch,
+					     FILEIO_BACKUP_SESSION * session);
 static int fileio_read_restore_header (FILEIO_BACKUP_SESSION * session);
 static FILEIO_RELOCATION_VOLUME fileio_find_restore_volume (THREAD_ENTRY * thread_p, const char *dbname,
 							    char *to_volname, int unit_num, FILEIO_BACKUP_LEVEL level,
@@ -547,7 +588,8 @@ static FILEIO_BACKUP_SESSION *fileio_continue_restore (THREAD_ENTRY * thread_p,
 						       INT64 db_creation, FILEIO_BACKUP_SESSION * session,
 						       bool first_time, bool authenticate, INT64 match_bkupcreation);
 static int fileio_fill_hole_during_restore (THREAD_ENTRY * thread_p, int *next_pageid, int stop_pageid,
-					    FILEIO_BACKUP_SESSION * session, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
+					    FILEIO_BACKUP_SESSION * session, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap,
+					    FILEIO_RESTORE_WRITE_BATCH * batch);
 static int fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, int nbytes);
 static FILEIO_NODE *fileio_allocate_node (FILEIO_QUEUE * qp, FILEIO_BACKUP_HEADER * backup_hdr);
 static FILEIO_NODE *fileio_free_node (FILEIO_QUEUE * qp, FILEIO_NODE * node);
@@ -555,6 +597,12 @@ static FILEIO_NODE *fileio_delete_queue_head (FILEIO_QUEUE * qp);
 static int fileio_compress_backup_node (FILEIO_NODE * node, FILEIO_BACKUP_HEADER * backup_hdr);
 static int fileio_write_backup_node (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, FILEIO_NODE * node,
 				     FILEIO_BACKUP_HEADER * backup_hdr);
+#if !defined (CS_MODE)
+static volatile INT64 *fileio_get_changed_sector (VOLID volid, PAGEID pageid, bool is_create);
+static bool fileio_use_changed_page_tracking (FILEIO_BACKUP_SESSION * session, bool only_updated_pages);
+static bool fileio_is_unchanged_backup_sector (FILEIO_BACKUP_SESSION * session, PAGEID pageid);
+static void fileio_verify_unchanged_backup_page (FILEIO_BACKUP_SESSION * session, FILEIO_NODE * node);
+#endif /* !CS_MODE */
 static char *fileio_ctime (INT64 * clock, char *buf);
 static const char *fileio_get_backup_level_string (FILEIO_BACKUP_LEVEL level);
 
@@ -2750,19 +2798,33 @@ fileio_unformat_and_rename (THREAD_ENTRY * thread_p, const char *vol_label_p, co
  *   to_vlabel(in): To Volume label
  *   to_volid(in): Volume identifier assigned to the copy
  *   reset_rcvinfo(in): Reset recovery information?
+ *   sector_map(in): Reserved sectors of the volume, one bit per sector as in the disk sector table, or NULL
+ *   nsects_map(in): Number of sectors described by sector_map
+ *   nread_pages(out): Number of pages read from the volume, or NULL
  *
  * Note: Format a new volume with the number of given pages and copy
  *       the contents of the volume associated with from_vdes onto the
  *       new generated volume. The recovery information kept in every
  *       page may be optionally initialized.
+ *       The volume is copied one sector at a time. Sectors that sector_map
+ *       marks as not reserved are not read; their pages are written as
+ *       initialized pages, like fileio_format writes them, so that they are
+ *       not mistaken for pages of another volume when they are fixed later.
  */
 int
 fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vol_desc, DKNPAGES npages, const char *to_vol_label_p,
-		    VOLID to_vol_id, bool is_reset_recovery_info)
+		    VOLID to_vol_id, bool is_reset_recovery_info, const UINT64 * sector_map, DKNSECTS nsects_map,
+		    DKNPAGES * nread_pages)
 {
   PAGEID page_id;
-  FILEIO_PAGE *malloc_io_page_p = NULL;
+  SECTID sect_id;
+  char *malloc_io_pages_p = NULL;
+  char *malloc_init_pages_p = NULL;
+  int num_pages;
+  int i;
+  DKNPAGES nskipped_pages = 0;
   int to_vol_desc;
+  FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
 
   /*
    * Create the to_volume. Don't initialize the volume with recovery
@@ -2783,43 +2845,72 @@ fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vol_desc, DKNPAGES npages,
     }
 
   /* Don't read the pages from the page buffer pool but directly from disk */
-  malloc_io_page_p = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
-  if (malloc_io_page_p == NULL)
+  malloc_io_pages_p = (char *) malloc ((size_t) IO_PAGESIZE * DISK_SECTOR_NPAGES);
+  if (malloc_io_pages_p == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE * DISK_SECTOR_NPAGES);
       goto error;
     }
 
-  if (is_reset_recovery_info == false)
+  if (sector_map != NULL)
     {
-      /* Copy the volume as it is */
-      for (page_id = 0; page_id < npages; page_id++)
+      /* the pages written for the sectors that are not reserved */
+      malloc_init_pages_p = (char *) malloc ((size_t) IO_PAGESIZE * DISK_SECTOR_NPAGES);
+      if (malloc_init_pages_p == NULL)
 	{
-	  if (fileio_read (thread_p, from_vol_desc, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL
-	      || fileio_write_or_add_to_dwb (thread_p, to_vol_desc, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL)
-	    {
-	      goto error;
-	    }
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  (size_t) IO_PAGESIZE * DISK_SECTOR_NPAGES);
+	  goto error;
+	}
+      memset (malloc_init_pages_p, 0, (size_t) IO_PAGESIZE * DISK_SECTOR_NPAGES);
+      for (i = 0; i < DISK_SECTOR_NPAGES; i++)
+	{
+	  fileio_initialize_res (thread_p, (FILEIO_PAGE *) (malloc_init_pages_p + (size_t) i * IO_PAGESIZE),
+				 IO_PAGESIZE);
 	}
     }
-  else
+
+#if !defined (CS_MODE)
+  write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
+#endif
+
+  for (page_id = 0; page_id < npages; page_id += num_pages)
     {
-      /* Reset the recovery information. Just like if this was a formatted volume */
-      for (page_id = 0; page_id < npages; page_id++)
+      num_pages = MIN (DISK_SECTOR_NPAGES, npages - page_id);
+
+      sect_id = SECTOR_FROM_PAGEID (page_id);
+      if (sector_map != NULL && sect_id < nsects_map
+	  && !bit64_is_set (sector_map[sect_id / FILEIO_SECTOR_MAP_UNIT_BITS], sect_id % FILEIO_SECTOR_MAP_UNIT_BITS))
 	{
-	  if (fileio_read (thread_p, from_vol_desc, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL)
+	  /* nothing was ever allocated in the sector; there is nothing to read */
+	  if (fileio_write_pages (thread_p, to_vol_desc, malloc_init_pages_p, page_id, num_pages, IO_PAGESIZE,
+				  write_mode) == NULL)
 	    {
 	      goto error;
 	    }
-	  else
+	  nskipped_pages += num_pages;
+	  continue;
+	}
+
+      if (fileio_read_pages (thread_p, from_vol_desc, malloc_io_pages_p, page_id, num_pages, IO_PAGESIZE) == NULL)
+	{
+	  goto error;
+	}
+
+      if (is_reset_recovery_info == true)
+	{
+	  /* Reset the recovery information. Just like if this was a formatted volume */
+	  for (i = 0; i < num_pages; i++)
 	    {
-	      fileio_reset_page_lsa (malloc_io_page_p, IO_PAGESIZE);
-	      if (fileio_write_or_add_to_dwb (thread_p, to_vol_desc, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL)
-		{
-		  goto error;
-		}
+	      fileio_reset_page_lsa ((FILEIO_PAGE *) (malloc_io_pages_p + (size_t) i * IO_PAGESIZE), IO_PAGESIZE);
 	    }
 	}
+
+      if (fileio_write_pages (thread_p, to_vol_desc, malloc_io_pages_p, page_id, num_pages, IO_PAGESIZE, write_mode)
+	  == NULL)
+	{
+	  goto error;
+	}
     }
 
   if (fileio_synchronize (thread_p, to_vol_desc, to_vol_label_p, FILEIO_SYNC_ALSO_FLUSH_DWB) != to_vol_desc)
@@ -2827,15 +2918,28 @@ fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vol_desc, DKNPAGES npages,
       goto error;
     }
 
-  free_and_init (malloc_io_page_p);
+  if (nread_pages != NULL)
+    {
+      *nread_pages = npages - nskipped_pages;
+    }
+
+  free_and_init (malloc_io_pages_p);
+  if (malloc_init_pages_p != NULL)
+    {
+      free_and_init (malloc_init_pages_p);
+    }
   return to_vol_desc;
 
 error:
   fileio_dismount (thread_p, to_vol_desc);
   fileio_unformat (thread_p, to_vol_label_p);
-  if (malloc_io_page_p != NULL)
+  if (malloc_io_pages_p != NULL)
     {
-      free_and_init (malloc_io_page_p);
+      free_and_init (malloc_io_pages_p);
+    }
+  if (malloc_init_pages_p != NULL)
+    {
+      free_and_init (malloc_init_pages_p);
     }
 
   return NULL_VOLDES;
@@ -7740,6 +7844,231 @@ exit_on_error:
   goto exit_on_end;
 }
 
+#if !defined (CS_MODE)
+/*
+ * fileio_start_changed_page_tracking () - Let incremental backups rely on changed page tracking
+ *   return: void
+ *   start_lsa(in): log append lsa once restart recovery is complete
+ *
+ * Note: Every page carrying an lsa after start_lsa was flushed by this server and its sector has been marked.
+ */
+void
+fileio_start_changed_page_tracking (const LOG_LSA * start_lsa)
+{
+  LSA_COPY (&fileio_Changed_pages_start_lsa, start_lsa);
+  fileio_Changed_pages_lost = false;
+}
+
+/*
+ * fileio_finalize_changed_page_tracking () - Free changed page tracking of all volumes
+ *   return: void
+ */
+void
+fileio_finalize_changed_page_tracking (void)
+{
+  INT64 **chunks;
+  VOLID volid;
+  int i;
+
+  LSA_SET_NULL (&fileio_Changed_pages_start_lsa);
+
+  for (volid = LOG_DBFIRST_VOLID; volid <= LOG_MAX_DBVOLID; volid++)
+    {
+      chunks = fileio_Changed_sectors[volid];
+      if (chunks == NULL)
+	{
+	  continue;
+	}
+
+      for (i = 0; i < FILEIO_CHANGED_SECTORS_NCHUNKS; i++)
+	{
+	  if (chunks[i] != NULL)
+	    {
+	      free_and_init (chunks[i]);
+	    }
+	}
+      free (chunks);
+      fileio_Changed_sectors[volid] = NULL;
+    }
+}
+
+/*
+ * fileio_get_changed_sector () - Get the changed page tracking entry of the sector of a page
+ *   return: pointer to the highest log page id flushed to the sector, or NULL
+ *   volid(in): permanent volume identifier
+ *   pageid(in): page identifier
+ *   is_create(in): allocate the entry if missing
+ *
+ * Note: When is_create is false, NULL means nothing was flushed to the sector since the server started.
+ */
+static volatile INT64 *
+fileio_get_changed_sector (VOLID volid, PAGEID pageid, bool is_create)
+{
+  INT64 **chunks, **new_chunks;
+  INT64 *chunk, *new_chunk;
+  SECTID sectid = pageid / DISK_SECTOR_NPAGES;
+  int chunk_idx = sectid / FILEIO_CHANGED_SECTORS_PER_CHUNK;
+  int i;
+
+  assert (volid >= LOG_DBFIRST_VOLID && volid <= LOG_MAX_DBVOLID && pageid >= 0);
+
+  if (chunk_idx >= FILEIO_CHANGED_SECTORS_NCHUNKS)
+    {
+      assert (false);
+      return NULL;
+    }
+
+  chunks = fileio_Changed_sectors[volid];
+  if (chunks == NULL)
+    {
+      if (!is_create)
+	{
+	  return NULL;
+	}
+
+      new_chunks = (INT64 **) calloc (FILEIO_CHANGED_SECTORS_NCHUNKS, sizeof (INT64 *));
+      if (new_chunks == NULL)
+	{
+	  return NULL;
+	}
+      if (!ATOMIC_CAS_ADDR (&fileio_Changed_sectors[volid], (INT64 **) NULL, new_chunks))
+	{
+	  /* another flusher was faster */
+	  free (new_chunks);
+	}
+      chunks = fileio_Changed_sectors[volid];
+    }
+
+  chunk = chunks[chunk_idx];
+  if (chunk == NULL)
+    {
+      if (!is_create)
+	{
+	  return NULL;
+	}
+
+      new_chunk = (INT64 *) malloc (FILEIO_CHANGED_SECTORS_PER_CHUNK * sizeof (INT64));
+      if (new_chunk == NULL)
+	{
+	  return NULL;
+	}
+      for (i = 0; i < FILEIO_CHANGED_SECTORS_PER_CHUNK; i++)
+	{
+	  new_chunk[i] = NULL_LOG_PAGEID;
+	}
+      if (!ATOMIC_CAS_ADDR (&chunks[chunk_idx], (INT64 *) NULL, new_chunk))
+	{
+	  free (new_chunk);
+	}
+      chunk = chunks[chunk_idx];
+    }
+
+  return &chunk[sectid % FILEIO_CHANGED_SECTORS_PER_CHUNK];
+}
+
+/*
+ * fileio_mark_changed_page () - Record that a page of a permanent volume is about to be written to disk
+ *   return: void
+ *   volid(in): volume identifier
+ *   pageid(in): page identifier
+ *   lsa(in): lsa of the page being written
+ *
+ * Note: Must be called before the page reaches the disk, so that a concurrent backup can not read the new page and
+ *       still find its sector unchanged.
+ */
+void
+fileio_mark_changed_page (VOLID volid, PAGEID pageid, const LOG_LSA * lsa)
+{
+  volatile INT64 *sector_p;
+  INT64 flushed_pageid;
+
+  if (volid < LOG_DBFIRST_VOLID || volid > LOG_MAX_DBVOLID || pageid < 0 || LSA_ISNULL (lsa))
+    {
+      /* pages without lsa are never considered changed by incremental backups either */
+      return;
+    }
+
+  sector_p = fileio_get_changed_sector (volid, pageid, true);
+  if (sector_p == NULL)
+    {
+      /* out of memory; incremental backups have to compare every page lsa again */
+      fileio_Changed_pages_lost = true;
+      return;
+    }
+
+  do
+    {
+      flushed_pageid = ATOMIC_LOAD_64 (sector_p);
+      if (flushed_pageid >= lsa->pageid)
+	{
+	  return;
+	}
+    }
+  while (!ATOMIC_CAS_64 (sector_p, flushed_pageid, (INT64) lsa->pageid));
+}
+
+/*
+ * fileio_use_changed_page_tracking () - Can the backup of the session volume rely on changed page tracking?
+ *   return: true if sectors not flushed since the previous backup may be skipped
+ *   session(in): backup session
+ *   only_updated_pages(in): true if only the pages updated since the previous backup are saved
+ */
+static bool
+fileio_use_changed_page_tracking (FILEIO_BACKUP_SESSION * session_p, bool only_updated_pages)
+{
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+  return (only_updated_pages && !LSA_ISNULL (&session_p->dbfile.lsa)
+	  && session_p->dbfile.volid >= LOG_DBFIRST_VOLID && session_p->dbfile.volid <= LOG_MAX_DBVOLID
+	  && session_p->bkup.bkuphdr->bkpagesize == IO_PAGESIZE && !LSA_ISNULL (&fileio_Changed_pages_start_lsa)
+	  && !LSA_LT (&session_p->dbfile.lsa, &fileio_Changed_pages_start_lsa));
+#else /* SERVER_MODE && !WINDOWS */
+  /* volume pages are read sequentially; there is no skipping them. */
+  return false;
+#endif /* SERVER_MODE && !WINDOWS */
+}
+
+/*
+ * fileio_is_unchanged_backup_sector () - Was nothing flushed to the sector of a page since the previous backup?
+ *   return: true if the sector can be skipped by the backup
+ *   session(in): backup session
+ *   pageid(in): page identifier
+ */
+static bool
+fileio_is_unchanged_backup_sector (FILEIO_BACKUP_SESSION * session_p, PAGEID pageid)
+{
+  volatile INT64 *sector_p;
+
+  if (fileio_Changed_pages_lost)
+    {
+      return false;
+    }
+
+  sector_p = fileio_get_changed_sector (session_p->dbfile.volid, pageid, false);
+  return sector_p == NULL || ATOMIC_LOAD_64 (sector_p) < session_p->dbfile.lsa.pageid;
+}
+
+/*
+ * fileio_verify_unchanged_backup_page () - Cross-check a page of a sector found unchanged against its lsa
+ *   return: void
+ *   session(in): backup session
+ *   node(in): page read from the volume
+ */
+static void
+fileio_verify_unchanged_backup_page (FILEIO_BACKUP_SESSION * session_p, FILEIO_NODE * node_p)
+{
+  char msg[1024];
+
+  if (LSA_LT (&session_p->dbfile.lsa, &node_p->area->iopage.prv.lsa))
+    {
+      snprintf (msg, sizeof (msg), "changed page tracking missed page %d|%d with lsa %lld|%d (backup lsa %lld|%d)\n",
+		session_p->dbfile.volid, node_p->pageid, LSA_AS_ARGS (&node_p->area->iopage.prv.lsa),
+		LSA_AS_ARGS (&session_p->dbfile.lsa));
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_FAILED_ASSERTION, 1, msg);
+      assert (false);
+    }
+}
+#endif /* !CS_MODE */
+
 /*
  * fileio_read_backup_volume () -
  *   return:
@@ -7756,6 +8085,8 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
   bool need_unlock = false;
   FILEIO_BACKUP_HEADER *backup_header_p;
   FILEIO_BACKUP_PAGE *save_area_p;
+  bool use_changed_pages;
+  bool is_unchanged_sector = false;
 
   if (thread_p == NULL)
     {
@@ -7773,6 +8104,7 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
     }
 
   thread_info_p = &session_p->read_thread_info;
+  use_changed_pages = fileio_use_changed_page_tracking (session_p, thread_info_p->only_updated_pages);
   queue_p = &thread_info_p->io_queue;
   /* thread service routine has tran_index_lock, and should release before it is working */
   pthread_mutex_unlock (&thread_p->tran_index_lock);
@@ -7829,6 +8161,20 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 	  break;
 	}
 
+      if (use_changed_pages)
+	{
+	  is_unchanged_sector = fileio_is_unchanged_backup_sector (session_p, thread_info_p->pageid);
+	  if (is_unchanged_sector && !prm_get_bool_value (PRM_ID_BACKUP_VERIFY_CHANGED_PAGES))
+	    {
+	      /* nothing was flushed to the rest of this sector since the previous backup */
+	      thread_info_p->pageid = MIN (DISK_SECTOR_NPAGES * (thread_info_p->pageid / DISK_SECTOR_NPAGES + 1),
+					   thread_info_p->from_npages);
+	      pthread_mutex_unlock (&thread_info_p->mtx);
+	      node_p = NULL;	/* the previous page has already been handed to the write thread */
+	      continue;
+	    }
+	}
+
       /* alloc queue node */
       node_p = fileio_allocate_node (queue_p, backup_header_p);
       if (node_p == NULL)
@@ -7878,6 +8224,11 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
        * of this level or a lower level.
        */
 
+      if (is_unchanged_sector)
+	{
+	  fileio_verify_unchanged_backup_page (session_p, node_p);
+	}
+
       if (thread_info_p->only_updated_pages == false || LSA_ISNULL (&session_p->dbfile.lsa)
 	  || LSA_LT (&session_p->dbfile.lsa, &node_p->area->iopage.prv.lsa))
 	{
@@ -8180,6 +8531,8 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
   FILEIO_BACKUP_HEADER *backup_header_p;
   int rv;
   bool is_need_vol_closed;
+  bool use_changed_pages;
+  bool is_unchanged_sector = false;
 
 #if (defined(WINDOWS) || !defined(SERVER_MODE))
   off_t saved_act_log_fp = (off_t) - 1;
@@ -8301,6 +8654,9 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
       check_npages = (int) (((float) from_npages / 25.0) * check_ratio);
     }
 
+  /* Incremental backups skip the sectors that were not flushed since the previous backup. */
+  use_changed_pages = fileio_use_changed_page_tracking (session_p, is_only_updated_pages);
+
   thread_info_p = &session_p->read_thread_info;
   queue_p = &thread_info_p->io_queue;
   /* set the number of activated read threads */
@@ -8333,6 +8689,17 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	      goto error;
 	    }
 
+	  if (use_changed_pages)
+	    {
+	      is_unchanged_sector = fileio_is_unchanged_backup_sector (session_p, page_id);
+	      if (is_unchanged_sector && !prm_get_bool_value (PRM_ID_BACKUP_VERIFY_CHANGED_PAGES))
+		{
+		  /* nothing was flushed to the rest of this sector since the previous backup */
+		  page_id = MIN (DISK_SECTOR_NPAGES * (page_id / DISK_SECTOR_NPAGES + 1), from_npages) - 1;
+		  continue;
+		}
+	    }
+
 	  /* alloc queue node */
 	  node_p = fileio_allocate_node (queue_p, backup_header_p);
 	  if (node_p == NULL)
@@ -8364,6 +8731,11 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	   * of this level or a lower level.
 	   */
 
+	  if (is_unchanged_sector)
+	    {
+	      fileio_verify_unchanged_backup_page (session_p, node_p);
+	    }
+
 	  if (is_only_updated_pages == false || LSA_ISNULL (&session_p->dbfile.lsa)
 	      || LSA_LT (&session_p->dbfile.lsa, &node_p->area->iopage.prv.lsa))
 	    {
@@ -9984,7 +10356,8 @@ fileio_get_next_restore_file (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * s
  */
 static int
 fileio_fill_hole_during_restore (THREAD_ENTRY * thread_p, int *next_page_id_p, int stop_page_id,
-				 FILEIO_BACKUP_SESSION * session_p, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap)
+				 FILEIO_BACKUP_SESSION * session_p, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap,
+				 FILEIO_RESTORE_WRITE_BATCH * batch)
 {
   FILEIO_PAGE *malloc_io_pgptr = NULL;
 
@@ -10007,10 +10380,11 @@ fileio_fill_hole_during_restore (THREAD_ENTRY * thread_p, int *next_page_id_p, i
        * is a hole of some kind that must be filled in with correctly
        * formatted pages.
        */
-      if (fileio_write_restore (thread_p, page_bitmap, session_p->dbfile.vdes, malloc_io_pgptr, session_p->dbfile.volid,
-				*next_page_id_p, session_p->dbfile.level) == NULL)
+      if (fileio_add_restore_write_batch (thread_p, batch, session_p, page_bitmap, malloc_io_pgptr, *next_page_id_p)
+	  != NO_ERROR)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, session_p->bkup.bkuphdr->unit_num);
+	  free_and_init (malloc_io_pgptr);
 	  return ER_FAILED;
 	}
       *next_page_id_p += 1;
@@ -10199,6 +10573,12 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
   int i;
   char *buffer_p;
   bool incremental_includes_volume_header = false;
+  FILEIO_RESTORE_WRITE_BATCH batch;
+
+  /* without the batch buffer, pages are simply written one by one */
+  batch.pages = (char *) malloc ((size_t) IO_PAGESIZE * FILEIO_RESTORE_WRITE_BATCH_PAGES);
+  batch.first_page_id = NULL_PAGEID;
+  batch.num_pages = 0;
 
   npages = (int) CEIL_PTVDIV (session_p->dbfile.nbytes, IO_PAGESIZE);
   session_p->dbfile.vlabel = to_vol_label_p;
@@ -10271,7 +10651,8 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
 	   */
 	  if (session_p->dbfile.level == FILEIO_BACKUP_FULL_LEVEL && next_page_id < npages)
 	    {
-	      if (fileio_fill_hole_during_restore (thread_p, &next_page_id, npages, session_p, bitmap) != NO_ERROR)
+	      if (fileio_fill_hole_during_restore (thread_p, &next_page_id, npages, session_p, bitmap, &batch)
+		  != NO_ERROR)
 		{
 		  goto error;
 		}
@@ -10305,7 +10686,7 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
 	  && (next_page_id < FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area)))
 	{
 	  if (fileio_fill_hole_during_restore (thread_p, &next_page_id, session_p->dbfile.area->iopageid, session_p,
-					       bitmap) != NO_ERROR)
+					       bitmap, &batch) != NO_ERROR)
 	    {
 	      goto error;
 	    }
@@ -10324,8 +10705,8 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
       buffer_p = (char *) &session_p->dbfile.area->iopage;
       for (i = 0; i < unit && next_page_id < npages; i++)
 	{
-	  if (fileio_write_restore (thread_p, bitmap, session_p->dbfile.vdes, buffer_p + i * IO_PAGESIZE,
-				    session_p->dbfile.volid, next_page_id, session_p->dbfile.level) == NULL)
+	  if (fileio_add_restore_write_batch (thread_p, &batch, session_p, bitmap, buffer_p + i * IO_PAGESIZE,
+					      next_page_id) != NO_ERROR)
 	    {
 	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
 	      goto error;
@@ -10342,6 +10723,12 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
 	}
     }
 
+  if (fileio_flush_restore_write_batch (thread_p, &batch, session_p) != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
+      goto error;
+    }
+
   if (total_nbytes > session_p->dbfile.nbytes && session_p->dbfile.volid < LOG_DBFIRST_VOLID)
     {
       (void) ftruncate (session_p->dbfile.vdes, session_p->dbfile.nbytes);
@@ -10440,6 +10827,11 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
   session_p->dbfile.volid = NULL_VOLID;
   session_p->dbfile.vlabel = NULL;
 
+  if (batch.pages != NULL)
+    {
+      free_and_init (batch.pages);
+    }
+
   if (session_p->verbose_fp)
     {
       if (next_page_id < 25)
@@ -10469,6 +10861,11 @@ error:
   session_p->dbfile.volid = NULL_VOLID;
   session_p->dbfile.vlabel = NULL;
 
+  if (batch.pages != NULL)
+    {
+      free_and_init (batch.pages);
+    }
+
   return ER_FAILED;
 }
 #endif /* !CS_MODE */
@@ -10532,6 +10929,94 @@ fileio_write_restore (THREAD_ENTRY * thread_p, FILEIO_RESTORE_PAGE_BITMAP * page
   return io_page_p;
 }
 
+/*
+ * fileio_add_restore_write_batch () - Queue a restored page to be written to the volume being restored
+ *   return: NO_ERROR or ER_FAILED
+ *   batch(in/out): pages waiting to be written
+ *   session_p(in): restore session; the page goes to session_p->dbfile.vdes
+ *   page_bitmap(in): Page bitmap to record which pages have already been restored, or NULL
+ *   io_page_p(in): content of the page, IO_PAGESIZE long
+ *   page_id(in): Page identifier
+ *
+ * Note: Pages already restored from a more recent backup level are skipped, as in fileio_write_restore (). The
+ *       buffered run is written out when the next page does not follow it or when the batch is full.
+ */
+static int
+fileio_add_restore_write_batch (THREAD_ENTRY * thread_p, FILEIO_RESTORE_WRITE_BATCH * batch,
+				FILEIO_BACKUP_SESSION * session_p, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap,
+				void *io_page_p, PAGEID page_id)
+{
+  if (batch->pages == NULL)
+    {
+      if (fileio_write_restore (thread_p, page_bitmap, session_p->dbfile.vdes, io_page_p, session_p->dbfile.volid,
+				page_id, session_p->dbfile.level) == NULL)
+	{
+	  return ER_FAILED;
+	}
+      return NO_ERROR;
+    }
+
+  if (page_bitmap != NULL && fileio_page_bitmap_is_set (page_bitmap, page_id))
+    {
+      /* a newer image of the page was already restored */
+      return NO_ERROR;
+    }
+
+  if (batch->num_pages > 0
+      && (page_id != batch->first_page_id + batch->num_pages || batch->num_pages >= FILEIO_RESTORE_WRITE_BATCH_PAGES))
+    {
+      if (fileio_flush_restore_write_batch (thread_p, batch, session_p) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  if (batch->num_pages == 0)
+    {
+      batch->first_page_id = page_id;
+    }
+  memcpy (batch->pages + (size_t) batch->num_pages * IO_PAGESIZE, io_page_p, IO_PAGESIZE);
+  batch->num_pages++;
+
+  if (page_bitmap != NULL && session_p->dbfile.level > FILEIO_BACKUP_FULL_LEVEL)
+    {
+      fileio_page_bitmap_set (page_bitmap, page_id);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_flush_restore_write_batch () - Write the buffered run of restored pages to the volume
+ *   return: NO_ERROR or ER_FAILED
+ *   batch(in/out): pages waiting to be written
+ *   session_p(in): restore session
+ */
+static int
+fileio_flush_restore_write_batch (THREAD_ENTRY * thread_p, FILEIO_RESTORE_WRITE_BATCH * batch,
+				  FILEIO_BACKUP_SESSION * session_p)
+{
+  FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
+
+  if (batch->num_pages == 0)
+    {
+      return NO_ERROR;
+    }
+
+#if !defined (CS_MODE)
+  write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
+#endif
+
+  if (fileio_write_pages (thread_p, session_p->dbfile.vdes, batch->pages, batch->first_page_id, batch->num_pages,
+			  IO_PAGESIZE, write_mode) == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  batch->num_pages = 0;
+  return NO_ERROR;
+}
+
 /*
  * fileio_skip_restore_volume () - Skip over the next db volume from the backup
  *                             during a restore
@@ -476,7 +476,8 @@ extern DKNPAGES fileio_truncate (VOLID volid, DKNPAGES npages_to_resize);
 extern void fileio_unformat (THREAD_ENTRY * thread_p, const char *vlabel);
 extern void fileio_unformat_and_rename (THREAD_ENTRY * thread_p, const char *vlabel, const char *new_vlabel);
 extern int fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vdes, DKNPAGES npages, const char *to_vlabel,
-			       VOLID to_volid, bool reset_recvinfo);
+			       VOLID to_volid, bool reset_recvinfo, const UINT64 * sector_map, DKNSECTS nsects_map,
+			       DKNPAGES * nread_pages);
 extern int fileio_reset_volume (THREAD_ENTRY * thread_p, int vdes, const char *vlabel, DKNPAGES npages,
 				const LOG_LSA * reset_lsa);
 extern int fileio_mount (THREAD_ENTRY * thread_p, const char *db_fullname, const char *vlabel, VOLID volid,
@@ -566,6 +567,11 @@ extern FILEIO_BACKUP_SESSION *fileio_finish_backup (THREAD_ENTRY * thread_p, FIL
 extern void fileio_abort_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, bool does_unformat_bk);
 extern int fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, const char *from_vlabel,
 				 VOLID from_volid, PAGEID last_page, bool only_updated_pages);
+#if !defined (CS_MODE)
+extern void fileio_start_changed_page_tracking (const LOG_LSA * start_lsa);
+extern void fileio_finalize_changed_page_tracking (void);
+extern void fileio_mark_changed_page (VOLID volid, PAGEID pageid, const LOG_LSA * lsa);
+#endif /* not CS_MODE */
 extern FILEIO_BACKUP_SESSION *fileio_start_restore (THREAD_ENTRY * thread_p, const char *db_fullname,
 						    char *backup_source, INT64 match_dbcreation,
 						    PGLENGTH * db_iopagesize, float *db_compatibility,
@@ -48,6 +48,7 @@
 #include "schema_system_catalog_constants.h"	/* for CT_SERIAL_NAME */
 #include "transform.h"
 #include "serial.h"
+#include "session.h"
 #include "object_primitive.h"
 #include "object_representation.h"
 #include "object_representation_sr.h"
@@ -278,6 +279,11 @@ struct heap_chain
 
 #define HEAP_CHK_ADD_UNFOUND_RELOCOIDS 100
 
+/* heap_compact_pages sleeps only when it is at least this far ahead of compactdb_page_rate_limit */
+#define HEAP_COMPACT_MIN_SLEEP_MSEC 10
+/* longest sleep of heap_compact_pages between two checks for interrupts */
+#define HEAP_COMPACT_MAX_SLEEP_MSEC 100
+
 typedef struct heap_chk_relocoid HEAP_CHK_RELOCOID;
 struct heap_chk_relocoid
 {
@@ -811,6 +817,7 @@ static int heap_insert_adjust_recdes_header (THREAD_ENTRY * thread_p, HEAP_OPERA
 static int heap_update_adjust_recdes_header (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * update_context,
 					     bool is_mvcc_class);
 static int heap_insert_handle_multipage_record (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
+static int heap_fix_last_insert_page (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
 static int heap_get_insert_location_with_lock (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context,
 					       PGBUF_WATCHER * home_hint_p);
 static int heap_find_location_and_insert_rec_newhome (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context);
@@ -878,6 +885,7 @@ STATIC_INLINE int heap_get_last_vpid (THREAD_ENTRY * thread_p, const HFID * hfid
   __attribute__ ((ALWAYS_INLINE));
 
 STATIC_INLINE bool check_supplemental_log (THREAD_ENTRY * thread_p, OID * classoid) __attribute__ ((ALWAYS_INLINE));
+static void heap_mark_authorization_change (THREAD_ENTRY * thread_p, const OID * class_oid);
 
 // *INDENT-OFF*
 static void heap_scancache_block_allocate (cubmem::block &b, size_t size);
@@ -4198,6 +4206,36 @@ check_supplemental_log (THREAD_ENTRY * thread_p, OID * classoid)
   return false;
 }
 
+/*
+ * heap_mark_authorization_change () - remember that the transaction modifies the authorization catalogs
+ *
+ * return	  : void
+ * thread_p (in)  : Thread entry
+ * class_oid (in) : Class of the modified record
+ *
+ * Note: Prepared statements shared between sessions were authorized by the clients that compiled them, so they
+ *	 cannot be shared while the authorization is changing.
+ */
+static void
+heap_mark_authorization_change (THREAD_ENTRY * thread_p, const OID * class_oid)
+{
+  LOG_TDES *tdes;
+
+  if (!oid_check_cached_class_oid (OID_CACHE_CLASSAUTH_CLASS_ID, class_oid)
+      && !oid_check_cached_class_oid (OID_CACHE_AUTH_CLASS_ID, class_oid)
+      && !oid_check_cached_class_oid (OID_CACHE_USER_CLASS_ID, class_oid))
+    {
+      return;
+    }
+
+  tdes = LOG_FIND_CURRENT_TDES (thread_p);
+  if (tdes != NULL && !tdes->has_authorization_change)
+    {
+      tdes->has_authorization_change = true;
+      session_begin_authorization_change (thread_p);
+    }
+}
+
 /*
  * heap_vpid_init_new () - FILE_INIT_PAGE_FUNC for heap non-header pages
  *
@@ -6887,6 +6925,8 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = mvcc_snapshot;
   scan_cache->partition_list = NULL;
+  scan_cache->reuse_insert_page = false;
+  VPID_SET_NULL (&scan_cache->last_insert_vpid);
 
   return ret;
 
@@ -6905,6 +6945,8 @@ exit_on_error:
   scan_cache->debug_initpattern = 0;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  scan_cache->reuse_insert_page = false;
+  VPID_SET_NULL (&scan_cache->last_insert_vpid);
 
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
@@ -7009,6 +7051,9 @@ heap_scancache_start_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cach
       heap_classrepr_free_and_init (classrepr, &classrepr_cacheindex);
     }
 
+  /* consecutive records of a multi-row insert are packed into the same page while it has room */
+  scan_cache->reuse_insert_page = (op_type == MULTI_ROW_INSERT);
+
   /* In case of SINGLE_ROW_INSERT, SINGLE_ROW_UPDATE, SINGLE_ROW_DELETE, or SINGLE_ROW_MODIFY, the 'num_btids' and
    * 'm_index_stats' of scan cache structure have to be set as 0 and NULL, respectively. */
 
@@ -7187,6 +7232,8 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  scan_cache->reuse_insert_page = false;
+  VPID_SET_NULL (&scan_cache->last_insert_vpid);
 
   return NO_ERROR;
 }
@@ -17043,6 +17090,9 @@ heap_get_class_info (THREAD_ENTRY * thread_p, const OID * class_oid, HFID * hfid
  * heap_compact_pages () - compact all pages from hfid of specified class OID
  *   return: error_code
  *   class_oid(out):  the class oid
+ *
+ * Note: Only fragmented pages are compacted and dirtied. When compactdb_page_rate_limit is set, the walk sleeps
+ *       without holding any page latch whenever it runs ahead of the allowed rate.
  */
 int
 heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
@@ -17054,6 +17104,13 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
   HFID hfid;
   PGBUF_WATCHER pg_watcher;
   PGBUF_WATCHER old_pg_watcher;
+  int page_rate_limit;
+  INT64 npages = 0;
+  INT64 sleep_msec;
+  struct timeval start_time, now;
+  OID page_class_oid;
+  PAGE_PTR pgptr = NULL;
+  bool continue_checking = true;
 
   if (class_oid == NULL)
     {
@@ -17095,6 +17152,9 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
 
   lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
 
+  page_rate_limit = prm_get_integer_value (PRM_ID_COMPACTDB_PAGE_RATE_LIMIT);
+  gettimeofday (&start_time, NULL);
+
   /* skip header page */
   ret = heap_vpid_next (thread_p, &hfid, pg_watcher.pgptr, &next_vpid);
   if (ret != NO_ERROR)
@@ -17125,16 +17185,85 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
 	  goto exit_on_error;
 	}
 
-      if (spage_compact (thread_p, pg_watcher.pgptr) != NO_ERROR)
+      if (spage_is_fragmented (pg_watcher.pgptr))
 	{
-	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
-	  ret = ER_FAILED;
-	  goto exit_on_error;
+	  if (spage_compact (thread_p, pg_watcher.pgptr) != NO_ERROR)
+	    {
+	      pgbuf_ordered_unfix (thread_p, &pg_watcher);
+	      ret = ER_FAILED;
+	      goto exit_on_error;
+	    }
+
+	  addr.pgptr = pg_watcher.pgptr;
+	  log_skip_logging (thread_p, &addr);
+	  pgbuf_set_dirty (thread_p, pg_watcher.pgptr, DONT_FREE);
+	}
+
+      npages++;
+      if (page_rate_limit > 0)
+	{
+	  gettimeofday (&now, NULL);
+	  sleep_msec = npages * 1000 / page_rate_limit - timeval_diff_in_msec (&now, &start_time);
+	  if (sleep_msec >= HEAP_COMPACT_MIN_SLEEP_MSEC)
+	    {
+	      /* Do not block the workload on this page while sleeping. */
+	      pgbuf_ordered_unfix (thread_p, &pg_watcher);
+
+	      while (sleep_msec > 0)
+		{
+		  thread_sleep ((double) MIN (sleep_msec, HEAP_COMPACT_MAX_SLEEP_MSEC));
+		  sleep_msec -= HEAP_COMPACT_MAX_SLEEP_MSEC;
+
+		  if (logtb_is_interrupted (thread_p, true, &continue_checking))
+		    {
+		      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+		      ret = ER_INTERRUPTED;
+		      goto exit_on_error;
+		    }
+		}
+
+	      /* Nothing was latched or locked during the sleep. Lock the class again, so that its heap file cannot be
+	       * destroyed, and refix the page only if it was not deallocated meanwhile. It must also still belong to
+	       * this heap for its chain to be followed; otherwise the walk stops. */
+	      if (lock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
+
+	      ret = pgbuf_fix_if_not_deallocated (thread_p, &vpid, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH, &pgptr);
+	      if (ret == NO_ERROR && pgptr != NULL)
+		{
+		  if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP || heap_is_page_header (thread_p, pgptr)
+		      || heap_get_class_oid_from_page (thread_p, pgptr, &page_class_oid) != NO_ERROR
+		      || !OID_EQ (&page_class_oid, class_oid))
+		    {
+		      VPID_SET_NULL (&next_vpid);
+		    }
+		  else
+		    {
+		      ret = heap_vpid_next (thread_p, &hfid, pgptr, &next_vpid);
+		    }
+		  pgbuf_unfix_and_init (thread_p, pgptr);
+		}
+	      else if (ret == NO_ERROR)
+		{
+		  /* deallocated */
+		  VPID_SET_NULL (&next_vpid);
+		}
+
+	      lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
+
+	      if (ret != NO_ERROR)
+		{
+		  goto exit_on_error;
+		}
+
+	      /* no page is kept fixed; the next one is fixed without a previous page */
+	      continue;
+	    }
 	}
 
-      addr.pgptr = pg_watcher.pgptr;
-      log_skip_logging (thread_p, &addr);
-      pgbuf_set_dirty (thread_p, pg_watcher.pgptr, DONT_FREE);
       pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
     }
 
@@ -20355,6 +20484,64 @@ heap_insert_handle_multipage_record (THREAD_ENTRY * thread_p, HEAP_OPERATION_CON
   return NO_ERROR;
 }
 
+/*
+ * heap_fix_last_insert_page () - fix the page of the previous insert of a multi-row insert if the new record fits
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread entry
+ *   context(in): operation context
+ *
+ * NOTE: On success context->home_page_watcher_p holds the page, or no page when the scan cache has no remembered page
+ *       or the page cannot take the record. Unlike heap_stats_find_best_page, the heap header page is not fixed, so
+ *       the records of a multi-row insert fill one page before the header is visited again.
+ */
+static int
+heap_fix_last_insert_page (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
+{
+  HEAP_SCANCACHE *scan_cache = context->scan_cache_p;
+  PAGE_PTR page_p;
+  OID page_class_oid;
+  int unfill_space;
+  int error_code;
+
+  assert (context->home_page_watcher_p->pgptr == NULL);
+
+  if (scan_cache == NULL || !scan_cache->reuse_insert_page || VPID_ISNULL (&scan_cache->last_insert_vpid))
+    {
+      return NO_ERROR;
+    }
+
+  error_code = pgbuf_ordered_fix (thread_p, &scan_cache->last_insert_vpid, OLD_PAGE_MAYBE_DEALLOCATED,
+				  PGBUF_LATCH_WRITE, context->home_page_watcher_p);
+  if (error_code != NO_ERROR)
+    {
+      if (error_code != ER_PB_BAD_PAGEID)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+
+      /* page was deallocated; fall back to the best space hints */
+      er_clear ();
+      VPID_SET_NULL (&scan_cache->last_insert_vpid);
+      return NO_ERROR;
+    }
+  page_p = context->home_page_watcher_p->pgptr;
+
+  /* keep the unfill space of the heap for updates, like heap_stats_find_best_page does */
+  unfill_space = (int) ((float) DB_PAGESIZE * prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
+
+  if (pgbuf_get_page_ptype (thread_p, page_p) != PAGE_HEAP
+      || heap_get_class_oid_from_page (thread_p, page_p, &page_class_oid) != NO_ERROR
+      || !OID_EQ (&page_class_oid, &context->class_oid)
+      || spage_max_space_for_new_record (thread_p, page_p) < context->recdes_p->length + unfill_space)
+    {
+      pgbuf_ordered_unfix (thread_p, context->home_page_watcher_p);
+      VPID_SET_NULL (&scan_cache->last_insert_vpid);
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * heap_get_insert_location_with_lock () - get a page (and possibly and slot)
  *				    for insert and lock the OID
@@ -20385,14 +20572,28 @@ heap_get_insert_location_with_lock (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONT
 
   if (home_hint_p == NULL)
     {
+      /* a multi-row insert first tries the page of its previous record */
+      error_code = heap_fix_last_insert_page (thread_p, context);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+
       /* find and fix page for insert */
-      if (heap_stats_find_best_page (thread_p, &context->hfid, context->recdes_p->length,
-				     (context->recdes_p->type != REC_NEWHOME), context->recdes_p->length,
-				     context->scan_cache_p, context->home_page_watcher_p) == NULL)
+      if (context->home_page_watcher_p->pgptr == NULL
+	  && heap_stats_find_best_page (thread_p, &context->hfid, context->recdes_p->length,
+					(context->recdes_p->type != REC_NEWHOME), context->recdes_p->length,
+					context->scan_cache_p, context->home_page_watcher_p) == NULL)
 	{
 	  ASSERT_ERROR_AND_SET (error_code);
 	  return error_code;
 	}
+
+      if (context->scan_cache_p != NULL && context->scan_cache_p->reuse_insert_page)
+	{
+	  pgbuf_get_vpid (context->home_page_watcher_p->pgptr, &context->scan_cache_p->last_insert_vpid);
+	}
     }
   else
     {
@@ -23000,6 +23201,8 @@ heap_insert_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context,
 	}
     }
 
+  heap_mark_authorization_change (thread_p, &context->class_oid);
+
   if (check_supplemental_log (thread_p, &context->class_oid) == true)
     {
       tdes = LOG_FIND_CURRENT_TDES (thread_p);
@@ -23269,6 +23472,8 @@ heap_delete_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
 
   HEAP_PERF_TRACK_PREPARE (thread_p, context);
 
+  heap_mark_authorization_change (thread_p, &context->class_oid);
+
   if (check_supplemental_log (thread_p, &context->class_oid) == true)
     {
       LOG_TDES *tdes = LOG_FIND_CURRENT_TDES (thread_p);
@@ -23486,6 +23691,8 @@ heap_update_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
 
   HEAP_PERF_TRACK_PREPARE (thread_p, context);
 
+  heap_mark_authorization_change (thread_p, &context->class_oid);
+
   if (check_supplemental_log (thread_p, &context->class_oid) == true)
     {
       LOG_TDES *tdes = LOG_FIND_CURRENT_TDES (thread_p);
@@ -157,6 +157,9 @@ struct heap_scancache
     MVCC_SNAPSHOT *mvcc_snapshot;	/* mvcc snapshot */
     HEAP_SCANCACHE_NODE_LIST *partition_list;	/* list holding the heap file information for partition nodes involved
 						 * in the scan */
+    bool reuse_insert_page;	/* MULTI_ROW_INSERT (INSERT ... SELECT, INSERT with several VALUES lists): try the page
+				 * of the previous insert of the statement before the best space hints */
+    VPID last_insert_vpid;	/* Page of the previous insert done through this cache, if reuse_insert_page */
 
 
     void start_area ();
@@ -10000,6 +10000,12 @@ copy_unflushed_lsa:
 	}
     }
 
+  if (!is_temp)
+    {
+      /* let incremental backups know this sector changed, before the page can be read from disk */
+      fileio_mark_changed_page (bufptr->vpid.volid, bufptr->vpid.pageid, &lsa);
+    }
+
 #if defined(ENABLE_SYSTEMTAP)
   query_id = qmgr_get_current_query_id (thread_p);
   if (query_id != NULL_QUERY_ID)
@@ -1269,6 +1269,25 @@ spage_compact (THREAD_ENTRY * thread_p, PAGE_PTR page_p)
   return NO_ERROR;
 }
 
+/*
+ * spage_is_fragmented () - Would compacting the page make its free space contiguous ?
+ *   return: true if part of the free space is in holes between records
+ *
+ *   page_p(in): Pointer to slotted page
+ */
+bool
+spage_is_fragmented (PAGE_PTR page_p)
+{
+  SPAGE_HEADER *page_header_p;
+
+  assert (page_p != NULL);
+
+  page_header_p = (SPAGE_HEADER *) page_p;
+  SPAGE_VERIFY_HEADER (page_header_p);
+
+  return page_header_p->cont_free < page_header_p->total_free;
+}
+
 /*
  * spage_find_free_slot () -
  *   return: void
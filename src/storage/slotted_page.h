@@ -146,6 +146,7 @@ extern void spage_collect_statistics (PAGE_PTR pgptr, int *npages, int *nrecords
 extern int spage_max_record_size (void);
 extern int spage_check_slot_owner (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PGSLOTID slotid);
 extern int spage_compact (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
+extern bool spage_is_fragmented (PAGE_PTR pgptr);
 extern bool spage_is_valid_anchor_type (const INT16 anchor_type);
 extern const char *spage_anchor_flag_string (const INT16 anchor_type);
 extern const char *spage_alignment_string (unsigned short alignment);
@@ -2483,6 +2483,8 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
    */
 
   log_initialize (thread_p, boot_Db_full_name, log_path, log_prefix, from_backup, r_args);
+  /* changes logged from now on are known to changed page tracking of incremental backups */
+  fileio_start_changed_page_tracking (log_get_append_lsa ());
 
   error_code = boot_after_copydb (thread_p);	// only does something if this is first boot after copydb
   if (error_code != NO_ERROR)
@@ -3881,6 +3883,7 @@ boot_server_all_finalize (THREAD_ENTRY * thread_p, ER_FINAL_CODE is_er_final,
   (void) heap_manager_finalize ();
   perfmon_finalize ();
   fileio_dismount_all (thread_p);
+  fileio_finalize_changed_page_tracking ();
   disk_manager_final ();
   boot_server_status (BOOT_SERVER_DOWN);
 
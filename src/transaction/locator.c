@@ -57,8 +57,9 @@ static int rv;
 #define LOCATOR_NKEEP_LIMIT (2)
 #endif /* SERVER_MODE */
 
+/* large enough to keep the areas of xlocator_fetch_all (), which are allocated on every call */
 #define LOCATOR_CACHED_COPYAREA_SIZE_LIMIT \
-  (IO_MAX_PAGE_SIZE * 2 + sizeof (LC_COPYAREA))
+  (IO_MAX_PAGE_SIZE * LC_FETCH_ALL_AREA_PAGES + sizeof (LC_COPYAREA))
 
 typedef struct locator_global LOCATOR_GLOBAL;
 struct locator_global
@@ -78,6 +78,9 @@
       (copy_area_ptr)->length - DB_SIZEOF(LC_COPYAREA_MANYOBJS); \
   } while (0)
 
+/* number of pages worth of instances returned by one xlocator_fetch_all () call */
+#define LC_FETCH_ALL_AREA_PAGES 16
+
 #define LC_REQOBJ_PACKED_SIZE (OR_OID_SIZE + OR_INT_SIZE * 2)
 #define LC_CLASS_OF_REQOBJ_PACKED_SIZE (OR_OID_SIZE + OR_INT_SIZE)
 
@@ -2873,8 +2873,9 @@ xlocator_fetch_all (THREAD_ENTRY * thread_p, const HFID * hfid, LOCK * lock, LC_
       goto error;
     }
 
-  /* Assume that the next object can fit in one page */
-  copyarea_length = DB_PAGESIZE;
+  /* Fill several pages per call: the caller (unloaddb, compactdb) makes one round trip per area, so a single page
+   * per call made the scan of a large class latency bound. The area still grows below if one object does not fit. */
+  copyarea_length = DB_PAGESIZE * LC_FETCH_ALL_AREA_PAGES;
 
   while (true)
     {
@@ -603,6 +603,9 @@ struct log_tdes
 
   bool has_supplemental_log;	/* Checks if supplemental log has been appended within the transaction */
 
+  bool has_authorization_change;	/* Authorization catalogs were modified within the transaction */
+  int authorization_version;	/* Authorization version of shared prepared statements at transaction start */
+
   // *INDENT-OFF*
 #if defined (SERVER_MODE) || (defined (SA_MODE) && defined (__cplusplus))
 
@@ -5342,6 +5342,7 @@ log_commit (THREAD_ENTRY * thread_p, int tran_index, bool retain_lock)
   bool decision;
   LOG_2PC_EXECUTE execute_2pc_type;
   int error_code = NO_ERROR;
+  int authorization_version;
 
   if (tran_index == NULL_TRAN_INDEX)
     {
@@ -5356,6 +5357,7 @@ log_commit (THREAD_ENTRY * thread_p, int tran_index, bool retain_lock)
       return TRAN_UNACTIVE_UNKNOWN;
     }
   assert (!tdes->is_system_worker_transaction ());
+  authorization_version = tdes->authorization_version;
 
   if (!LOG_ISTRAN_ACTIVE (tdes) && !LOG_ISTRAN_2PC_PREPARE (tdes) && LOG_ISRESTARTED ())
     {
@@ -5408,6 +5410,12 @@ log_commit (THREAD_ENTRY * thread_p, int tran_index, bool retain_lock)
       state = log_complete (thread_p, tdes, LOG_COMMIT, LOG_NEED_NEWTRID, LOG_ALREADY_WROTE_EOT_LOG);
     }
 
+  if (retain_lock)
+    {
+      /* the client keeps the authorization it cached; so does the transaction */
+      tdes->authorization_version = authorization_version;
+    }
+
   if (log_No_logging)
     {
       LOG_CS_ENTER (thread_p);
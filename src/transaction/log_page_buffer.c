@@ -9257,6 +9257,9 @@ logpb_copy_volume (THREAD_ENTRY * thread_p, VOLID from_volid, const char *to_vol
 {
   int from_vdes, to_vdes;	/* Descriptor for "from" and "to" volumes */
   DKNPAGES npages;		/* Size of the volume */
+  UINT64 *sector_map = NULL;	/* Reserved sectors of the volume */
+  DKNSECTS nsects_map;
+  DKNPAGES nread_pages;		/* Pages read from the reserved sectors */
   int error_code = NO_ERROR;
 
   /* Find the current pages of the volume and its descriptor */
@@ -9279,14 +9282,28 @@ logpb_copy_volume (THREAD_ENTRY * thread_p, VOLID from_volid, const char *to_vol
       return ER_FAILED;
     }
 
+  /* Only the sectors reserved by the disk manager need to be copied */
+  error_code = disk_get_reserved_sectors_map (thread_p, from_volid, &sector_map, &nsects_map);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
   /* Copy the database volume and initialize recovery information on it */
 
-  to_vdes = fileio_copy_volume (thread_p, from_vdes, npages, to_volname, LOG_DBCOPY_VOLID, true);
+  to_vdes =
+    fileio_copy_volume (thread_p, from_vdes, npages, to_volname, LOG_DBCOPY_VOLID, true, sector_map, nsects_map,
+			&nread_pages);
+  free_and_init (sector_map);
   if (to_vdes == NULL_VOLDES)
     {
       return ER_FAILED;
     }
 
+  fprintf (stdout, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOG, MSGCAT_LOG_COPYDB_VOLUME_COPIED), to_volname,
+	   npages, nread_pages);
+  fflush (stdout);
+
   /*
    * Change the name of the volume, its database creation time and its
    * checkpoint lsa
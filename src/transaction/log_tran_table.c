@@ -61,6 +61,7 @@
 #include "partition_sr.h"
 #include "btree_load.h"
 #include "serial.h"
+#include "session.h"
 #include "show_scan.h"
 #include "boot_sr.h"
 #include "tz_support.h"
@@ -1567,6 +1568,14 @@ logtb_clear_tdes (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
   tdes->m_log_postpone_cache.reset ();
   tdes->has_supplemental_log = false;
 
+  if (tdes->has_authorization_change)
+    {
+      /* the authorization changes are committed or rolled back */
+      session_end_authorization_change (thread_p);
+      tdes->has_authorization_change = false;
+    }
+  tdes->authorization_version = session_get_authorization_version ();
+
   logtb_tran_clear_update_stats (&tdes->log_upd_stats);
 
   assert (tdes->mvccinfo.id == MVCCID_NULL);
@@ -1682,6 +1691,9 @@ logtb_initialize_tdes (LOG_TDES * tdes, int tran_index)
 
   tdes->has_supplemental_log = false;
 
+  tdes->has_authorization_change = false;
+  tdes->authorization_version = session_get_authorization_version ();
+
   LSA_SET_NULL (&tdes->rcv.tran_start_postpone_lsa);
   LSA_SET_NULL (&tdes->rcv.sysop_start_postpone_lsa);
   LSA_SET_NULL (&tdes->rcv.atomic_sysop_start_lsa);
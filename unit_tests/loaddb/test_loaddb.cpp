@@ -20,11 +20,14 @@
  * test_loaddb.cpp - implementation for loaddb parse tests
  */
 
+#include <cstring>
+#include <iostream>
 #include <sstream>
 #include <thread>
 
 #include "language_support.h"
 #include "load_driver.hpp"
+#include "load_fast_scanner.hpp"
 #include "test_loaddb.hpp"
 
 namespace test_loaddb
@@ -88,4 +91,86 @@ namespace test_loaddb
 	threads[i].join ();
       }
   }
+
+  // print the constants the fast scanner makes of line as "type:value" items, or "refused"
+  static std::string
+  fast_scan (cubload::semantic_helper &helper, const char *line)
+  {
+    cubload::fast_scanner scanner (helper);
+    cubload::constant_type *constants;
+    const char *next_line;
+    std::string result;
+
+    if (!scanner.scan_line (line, line + std::strlen (line), constants, next_line))
+      {
+	return "refused";
+      }
+
+    for (cubload::constant_type *c = constants; c != NULL; c = c->next)
+      {
+	result.append (std::to_string (c->type));
+	if (c->val != NULL)
+	  {
+	    result.append (":").append (static_cast<cubload::string_type *> (c->val)->val);
+	  }
+	result.append (" ");
+      }
+    result.append ("next=").append (std::to_string (next_line - line));
+
+    helper.reset_after_line ();
+    return result;
+  }
+
+  int
+  test_fast_scanner ()
+  {
+    using namespace cubload;
+
+    struct
+    {
+      const char *line;
+      std::string expected;
+    } cases[] =
+    {
+      { "1 -2 +3\n", std::to_string (LDR_INT) + ":1 " + std::to_string (LDR_INT) + ":-2 "
+	+ std::to_string (LDR_INT) + ":+3 next=8" },
+      { ".5 1e10 3.14F\r\n", std::to_string (LDR_NUMERIC) + ":.5 " + std::to_string (LDR_DOUBLE) + ":1e10 "
+	+ std::to_string (LDR_FLOAT) + ":3.14F next=15" },
+      { "'' 'it''s' N'n' NULL\n", std::to_string (LDR_STR) + ": " + std::to_string (LDR_STR) + ":it's "
+	+ std::to_string (LDR_NSTR) + ":n " + std::to_string (LDR_NULL) + " next=21" },
+      { "date '2017-12-22' DATETIME'2017-12-22 12:10:21'\n", std::to_string (LDR_DATE) + ":2017-12-22 "
+	+ std::to_string (LDR_DATETIME) + ":2017-12-22 12:10:21 next=48" },
+      { " \t\n", "next=3" },
+      // left to the grammar
+      { "1 2", "refused" },
+      { "%class foo (a)\n", "refused" },
+      { "1: 2\n", "refused" },
+      { "12:30 1/2/2000\n", "refused" },
+      { "'aaaa' + \n", "refused" },
+      { "'a\nb'\n", "refused" },
+      { "\"dq\" @44 {1} $2.0F X'ff'\n", "refused" },
+      { "nullx\n", "refused" },
+      { "-- comment\n", "refused" },
+    };
+
+    lang_init ();
+    lang_set_charset_lang ("en_US.iso88591");
+
+    semantic_helper *helper = new semantic_helper ();
+    int err = 0;
+
+    for (const auto &c : cases)
+      {
+	std::string result = fast_scan (*helper, c.line);
+	if (result != c.expected)
+	  {
+	    std::cout << "fast_scanner: [" << c.line << "] gives [" << result << "], expected [" << c.expected << "]"
+		      << std::endl;
+	    err = 1;
+	  }
+      }
+
+    delete helper;
+    return err;
+  }
 } // namespace test_loaddb
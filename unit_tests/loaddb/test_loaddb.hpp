@@ -27,6 +27,7 @@ namespace test_loaddb
 {
   void test_parse_with_multiple_threads ();
   void test_parse_reusing_driver ();
+  int test_fast_scanner ();
 }; // namespace test_loaddb
 
 #endif //_TEST_LOADDB_PASRE_HPP_
@@ -24,5 +24,5 @@ main (int, char **)
   //test_loaddb::test_parse_with_multiple_threads ();
   //test_loaddb::test_parse_reusing_driver ();
 
-  return 0;
+  return test_loaddb::test_fast_scanner ();
 }
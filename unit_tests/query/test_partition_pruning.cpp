@@ -0,0 +1,159 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_partition_pruning.hpp"
+
+#include "memory_alloc.h"
+#include "partition_sr.h"
+#include "thread_entry.hpp"
+#include "thread_manager.hpp"
+#include "xasl.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace test_query
+{
+  //
+  // These tests follow the pruning state of the driving spec of a correlated subquery such as
+  //
+  //    SELECT o.id, (SELECT COUNT (*) FROM part_tbl p WHERE p.key = o.key) FROM outer_tbl o
+  //
+  // where the first outer row has a key that falls in no partition of part_tbl and the second one in a partition. The
+  // subquery spec is pruned when it is opened and reset when it is closed, once per outer row.
+  //
+  class private_heap_entry
+  {
+    public:
+      private_heap_entry ()
+	: m_thread_entry ()
+      {
+	cubthread::set_thread_local_entry (m_thread_entry);
+	m_thread_entry.private_heap_id = db_create_private_heap ();
+      }
+
+      ~private_heap_entry ()
+      {
+	db_clear_private_heap (&m_thread_entry, m_thread_entry.private_heap_id);
+	cubthread::clear_thread_local_entry ();
+      }
+
+      THREAD_ENTRY *get ()
+      {
+	return &m_thread_entry;
+      }
+
+    private:
+      THREAD_ENTRY m_thread_entry;
+  };
+
+  static int
+  check (bool condition, const char *what)
+  {
+    if (!condition)
+      {
+	std::cout << std::endl << "    failed: " << what;
+	return 1;
+      }
+    return 0;
+  }
+
+  // access_spec_node is not default constructible; the tests only need its pruning members
+  static ACCESS_SPEC_TYPE *
+  make_outer_pruned_spec (void)
+  {
+    ACCESS_SPEC_TYPE *spec = (ACCESS_SPEC_TYPE *) std::malloc (sizeof (ACCESS_SPEC_TYPE));
+
+    if (spec == NULL)
+      {
+	return NULL;
+      }
+    std::memset ((void *) spec, 0, sizeof (ACCESS_SPEC_TYPE));
+    spec->type = TARGET_CLASS;
+    spec->pruning_type = DB_PARTITIONED_CLASS;
+    spec->prune_with_outer_values = true;
+
+    return spec;
+  }
+
+  int
+  test_reset_after_no_partition (void)
+  {
+    private_heap_entry entry;
+    ACCESS_SPEC_TYPE *spec = make_outer_pruned_spec ();
+    int err = 0;
+
+    if (spec == NULL)
+      {
+	std::cout << std::endl << "    failed: malloc";
+	return 1;
+      }
+
+    // first outer row: pruning found no partition
+    spec->pruned = true;
+    spec->parts = NULL;
+    spec->curent = NULL;
+
+    // the scan is closed before the second outer row
+    partition_reset_spec_pruning (entry.get (), spec);
+
+    err += check (!spec->pruned, "spec is pruned again for the next outer row");
+    err += check (spec->parts == NULL && spec->curent == NULL, "no partitions are left");
+
+    std::free (spec);
+    return err;
+  }
+
+  int
+  test_reset_frees_partitions (void)
+  {
+    private_heap_entry entry;
+    ACCESS_SPEC_TYPE *spec = make_outer_pruned_spec ();
+    PARTITION_SPEC_TYPE *part;
+    int err = 0;
+
+    if (spec == NULL)
+      {
+	std::cout << std::endl << "    failed: malloc";
+	return 1;
+      }
+
+    // second outer row: pruning found one partition and the scan is on it
+    part = (PARTITION_SPEC_TYPE *) db_private_alloc (entry.get (), sizeof (PARTITION_SPEC_TYPE));
+    if (part == NULL)
+      {
+	std::cout << std::endl << "    failed: db_private_alloc";
+	std::free (spec);
+	return 1;
+      }
+    std::memset (part, 0, sizeof (PARTITION_SPEC_TYPE));
+    spec->pruned = true;
+    spec->parts = part;
+    spec->curent = part;
+
+    partition_reset_spec_pruning (entry.get (), spec);
+
+    err += check (!spec->pruned, "spec is pruned again for the next outer row");
+    err += check (spec->parts == NULL, "partitions are freed");
+    err += check (spec->curent == NULL, "current partition is reset");
+
+    std::free (spec);
+    return err;
+  }
+} // namespace test_query
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_PARTITION_PRUNING_HPP_
+#define _TEST_PARTITION_PRUNING_HPP_
+
+namespace test_query
+{
+  // a spec pruned with outer values is pruned again for each outer row, even after a row that found no partition
+  int test_reset_after_no_partition (void);
+
+  // the partitions found for an outer row are freed when the spec is reset
+  int test_reset_frees_partitions (void);
+} // namespace test_query
+
+#endif // _TEST_PARTITION_PRUNING_HPP_
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_topn.hpp"
+
+#include "fetch.h"
+#include "regu_var.hpp"
+
+#include <iostream>
+
+namespace test_query
+{
+  //
+  // The top-n sort of a query such as
+  //
+  //    SELECT a, b FROM (SELECT a, b FROM t) dt ORDER BY 2 LIMIT 10
+  //
+  // peeks the sort keys of each row to discard the rows that cannot enter the top-n before their tuple is built. The
+  // sort key of the derived table is a list file column (TYPE_POSITION), read from the tuple, so it must not be
+  // peeked.
+  //
+  static int
+  check (bool condition, const char *what)
+  {
+    if (!condition)
+      {
+	std::cout << std::endl << "    failed: " << what;
+	return 1;
+      }
+    return 0;
+  }
+
+  static void
+  init_regu (REGU_VARIABLE &regu, REGU_DATATYPE type)
+  {
+    regu.type = type;
+    regu.flags = 0;
+    regu.domain = NULL;
+    regu.original_domain = NULL;
+    regu.vfetch_to = NULL;
+    regu.xasl = NULL;
+  }
+
+  int
+  test_topn_positional_sort_key (void)
+  {
+    REGU_VARIABLE regu;
+    int err = 0;
+
+    init_regu (regu, TYPE_POSITION);
+    regu.value.pos_descr.pos_no = 1;
+    regu.value.pos_descr.dom = NULL;
+
+    err += check (!fetch_is_peekable_without_tuple (&regu), "list file column is not peekable");
+
+    return err;
+  }
+
+  int
+  test_topn_peekable_sort_keys (void)
+  {
+    REGU_VARIABLE regu;
+    int err = 0;
+
+    init_regu (regu, TYPE_ATTR_ID);
+    err += check (fetch_is_peekable_without_tuple (&regu), "attribute is peekable");
+
+    init_regu (regu, TYPE_DBVAL);
+    err += check (fetch_is_peekable_without_tuple (&regu), "value is peekable");
+
+    init_regu (regu, TYPE_CONSTANT);
+    err += check (fetch_is_peekable_without_tuple (&regu), "constant is peekable");
+
+    // a constant set by a subquery when the tuple is built; the subquery is only checked for, never read
+    regu.xasl = (xasl_node *) &regu;
+    err += check (!fetch_is_peekable_without_tuple (&regu), "subquery value is not peekable");
+
+    init_regu (regu, TYPE_INARITH);
+    err += check (!fetch_is_peekable_without_tuple (&regu), "expression is not peekable");
+
+    init_regu (regu, TYPE_ATTR_ID);
+    REGU_VARIABLE_SET_FLAG (&regu, REGU_VARIABLE_UPD_INS_LIST);
+    err += check (!fetch_is_peekable_without_tuple (&regu), "update/insert list attribute is not peekable");
+
+    return err;
+  }
+} // namespace test_query
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_TOPN_HPP_
+#define _TEST_TOPN_HPP_
+
+namespace test_query
+{
+  // sort keys that are list file columns are not compared before the tuple of the row is built
+  int test_topn_positional_sort_key (void);
+
+  // sort keys that reference already available values are compared before the tuple is built
+  int test_topn_peekable_sort_keys (void);
+} // namespace test_query
+
+#endif // _TEST_TOPN_HPP_
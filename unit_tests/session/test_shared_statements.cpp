@@ -0,0 +1,159 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_shared_statements.hpp"
+
+#include "session_shared_statements.hpp"
+
+#include <iostream>
+#include <string>
+
+namespace test_session
+{
+  using cubsession::shared_statement;
+  using cubsession::shared_statement_registry;
+
+  static shared_statement
+  make_statement (const char *alias_print, int sha1_seed)
+  {
+    SHA1Hash sha1 = SHA1_HASH_INITIALIZER;
+    const char info[] = { 'i', '\0', 'n', 'f', 'o' };
+
+    sha1.h[0] = sha1_seed;
+    return shared_statement (alias_print, sha1, info, sizeof (info));
+  }
+
+  static int
+  check (bool condition, const char *what)
+  {
+    if (!condition)
+      {
+	std::cout << std::endl << "    failed: " << what;
+	return 1;
+      }
+    return 0;
+  }
+
+  int
+  test_share_and_attach (void)
+  {
+    shared_statement_registry registry (16);
+    shared_statement found;
+    int version = registry.get_authorization_version ();
+    int err = 0;
+
+    err += check (registry.publish ("dba\nselect 1", version, make_statement ("select 1", 1)), "publish");
+    err += check (registry.find ("dba\nselect 1", found), "find published");
+    err += check (found.m_alias_print == "select 1" && found.m_sha1.h[0] == 1, "statement is copied");
+    err += check (found.m_info.size () == 5 && found.m_info[1] == '\0', "info is binary");
+    err += check (!registry.find ("public\nselect 1", found), "other user does not find it");
+
+    err += check (registry.publish ("dba\nselect 1", version, make_statement ("select 1", 2)), "republish");
+    err += check (registry.find ("dba\nselect 1", found) && found.m_sha1.h[0] == 2, "republish replaces");
+    err += check (registry.size () == 1, "republish does not add");
+
+    return err;
+  }
+
+  int
+  test_authorization_change (void)
+  {
+    shared_statement_registry registry (16);
+    shared_statement found;
+    int old_version = registry.get_authorization_version ();
+    int new_version;
+    int err = 0;
+
+    err += check (registry.publish ("u1\nselect * from t", old_version, make_statement ("select t", 1)), "publish");
+
+    // REVOKE is executed; until it commits the old authorization is in force but nothing new is shared
+    registry.begin_authorization_change ();
+    err += check (registry.find ("u1\nselect * from t", found), "attach while revoke is not committed");
+    err += check (!registry.publish ("u1\nselect * from u", old_version, make_statement ("select u", 2)),
+		  "no publish while revoke is not committed");
+
+    // REVOKE commits
+    registry.end_authorization_change ();
+    new_version = registry.get_authorization_version ();
+    err += check (new_version != old_version, "version changes");
+    err += check (!registry.find ("u1\nselect * from t", found), "no attach after revoke");
+    err += check (registry.size () == 0, "all statements dropped");
+
+    // a transaction started before the revoke may have compiled with the old authorization
+    err += check (!registry.publish ("u1\nselect * from t", old_version, make_statement ("select t", 1)),
+		  "no publish with authorization older than the revoke");
+    err += check (registry.publish ("u1\nselect * from t", new_version, make_statement ("select t", 1)),
+		  "publish with current authorization");
+
+    // two concurrent changes; statements are shared again only when both ended
+    registry.begin_authorization_change ();
+    registry.begin_authorization_change ();
+    registry.end_authorization_change ();
+    new_version = registry.get_authorization_version ();
+    err += check (!registry.publish ("u1\nselect 2", new_version, make_statement ("select 2", 3)),
+		  "no publish while another change is in progress");
+    registry.end_authorization_change ();
+    new_version = registry.get_authorization_version ();
+    err += check (registry.publish ("u1\nselect 2", new_version, make_statement ("select 2", 3)),
+		  "publish after all changes ended");
+
+    return err;
+  }
+
+  int
+  test_remove_by_xasl (void)
+  {
+    shared_statement_registry registry (16);
+    shared_statement found;
+    int version = registry.get_authorization_version ();
+    SHA1Hash sha1 = SHA1_HASH_INITIALIZER;
+    int err = 0;
+
+    err += check (registry.publish ("u1\nselect a", version, make_statement ("select a", 7)), "publish u1");
+    err += check (registry.publish ("u2\nselect a", version, make_statement ("select a", 7)), "publish u2");
+    err += check (registry.publish ("u1\nselect b", version, make_statement ("select b", 8)), "publish b");
+
+    sha1.h[0] = 7;
+    registry.remove (sha1);
+    err += check (!registry.find ("u1\nselect a", found) && !registry.find ("u2\nselect a", found),
+		  "statements of the XASL are removed");
+    err += check (registry.find ("u1\nselect b", found), "other statements are kept");
+
+    registry.clear ();
+    err += check (registry.size () == 0, "clear");
+
+    return err;
+  }
+
+  int
+  test_max_count (void)
+  {
+    shared_statement_registry registry (2);
+    shared_statement found;
+    int version = registry.get_authorization_version ();
+    int err = 0;
+
+    err += check (registry.publish ("u\n1", version, make_statement ("1", 1)), "publish 1");
+    err += check (registry.publish ("u\n2", version, make_statement ("2", 2)), "publish 2");
+    err += check (!registry.publish ("u\n3", version, make_statement ("3", 3)), "full registry refuses");
+    err += check (registry.publish ("u\n2", version, make_statement ("2", 4)), "full registry replaces");
+    err += check (registry.find ("u\n2", found) && found.m_sha1.h[0] == 4, "replaced");
+
+    return err;
+  }
+} // namespace test_session
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_SHARED_STATEMENTS_HPP_
+#define _TEST_SHARED_STATEMENTS_HPP_
+
+namespace test_session
+{
+  // a statement published by one session is attached by another
+  int test_share_and_attach (void);
+
+  // statements are dropped when authorization changes and are not published again with stale authorization
+  int test_authorization_change (void);
+
+  // statements are dropped with their XASL cache entry
+  int test_remove_by_xasl (void);
+
+  // no more than the maximum number of statements is kept
+  int test_max_count (void);
+} // namespace test_session
+
+#endif // _TEST_SHARED_STATEMENTS_HPP_
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_csv_field.hpp"
+
+#include "load_object.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace test_unloaddb
+{
+  static int
+  check (bool condition, const char *what)
+  {
+    if (!condition)
+      {
+	std::cout << std::endl << "    failed: " << what;
+	return 1;
+      }
+    return 0;
+  }
+
+  // print str as a CSV field to an output buffer large enough to never be flushed
+  static std::string
+  print_field (const char *str, int len)
+  {
+    char buffer[256];
+    TEXT_OUTPUT tout;
+
+    tout.buffer = buffer;
+    tout.ptr = buffer;
+    tout.iosize = sizeof (buffer);
+    tout.count = 0;
+    tout.fp = NULL;
+
+    if (text_print_csv_field (&tout, str, len) != NO_ERROR)
+      {
+	return "<error>";
+      }
+    return std::string (tout.buffer, tout.count);
+  }
+
+  static std::string
+  print_field (const char *str)
+  {
+    return print_field (str, (int) std::strlen (str));
+  }
+
+  int
+  test_csv_quoting (void)
+  {
+    int err = 0;
+
+    err += check (print_field ("abc") == "abc", "plain field is not quoted");
+    err += check (print_field ("a b;c") == "a b;c", "spaces and semicolons are not quoted");
+    err += check (print_field ("a,b") == "\"a,b\"", "comma is quoted");
+    err += check (print_field ("say \"hi\"") == "\"say \"\"hi\"\"\"", "embedded quotes are doubled");
+    err += check (print_field ("\"") == "\"\"\"\"", "lone quote");
+    err += check (print_field ("a\nb") == "\"a\nb\"", "line feed is quoted");
+    err += check (print_field ("a\rb") == "\"a\rb\"", "carriage return is quoted");
+    err += check (print_field ("a\r\nb") == "\"a\r\nb\"", "CR/LF is quoted");
+    err += check (print_field ("") == "\"\"", "empty string is quoted");
+    err += check (print_field ("abc", 0) == "\"\"", "empty prefix is an empty string");
+    err += check (print_field ("a,b", 1) == "a", "only len bytes are printed");
+
+    // NULL is the empty field, which no string prints to
+    err += check (!print_field ("").empty (), "empty string differs from NULL");
+
+    return err;
+  }
+
+  int
+  test_csv_flush (void)
+  {
+    const char field[] = "one \"two\", three\r\nfour \"five\"";
+    const char expected[] = "\"one \"\"two\"\", three\r\nfour \"\"five\"\"\"";
+    char buffer[16];		// shorter than the field, longer than each of its quote delimited parts
+    char result[sizeof (expected)];
+    TEXT_OUTPUT tout;
+    size_t nread;
+    int err = 0;
+
+    tout.buffer = buffer;
+    tout.ptr = buffer;
+    tout.iosize = sizeof (buffer);
+    tout.count = 0;
+    tout.fp = std::tmpfile ();
+    if (tout.fp == NULL)
+      {
+	std::cout << std::endl << "    failed: tmpfile";
+	return 1;
+      }
+
+    err += check (text_print_csv_field (&tout, field, (int) std::strlen (field)) == NO_ERROR, "print");
+    err += check (text_print_flush (&tout) == NO_ERROR, "flush");
+
+    std::rewind (tout.fp);
+    nread = std::fread (result, 1, sizeof (result), tout.fp);
+    err += check (nread == std::strlen (expected), "length");
+    err += check (std::memcmp (result, expected, std::strlen (expected)) == 0, "content");
+
+    std::fclose (tout.fp);
+    return err;
+  }
+} // namespace test_unloaddb
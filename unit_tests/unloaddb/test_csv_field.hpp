@@ -0,0 +1,31 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_CSV_FIELD_HPP_
+#define _TEST_CSV_FIELD_HPP_
+
+namespace test_unloaddb
+{
+  // fields are quoted only when they must be, and empty strings differ from NULL
+  int test_csv_quoting (void);
+
+  // a quoted field split over several buffer flushes reads back whole
+  int test_csv_flush (void);
+} // namespace test_unloaddb
+
+#endif // _TEST_CSV_FIELD_HPP_